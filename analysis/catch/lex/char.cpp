@@ -60,10 +60,38 @@ namespace cerb::debug
         return true;
     }
 
+    template<CharacterLiteral CharT>
+    CERBLIB_DECL auto testCharKinds() -> bool
+    {
+        for (u32 code = 0; code != 256; ++code) {// NOLINT
+            auto chr = static_cast<CharT>(code);
+            auto is_digit = code >= '0' && code <= '9';
+            auto is_uc_letter = code >= 'A' && code <= 'Z';
+            auto is_lc_letter = code >= 'a' && code <= 'z';
+
+            ASSERT_EQUAL(isLayout(chr), code != 0 && code <= ' ');
+            ASSERT_EQUAL(isDigit(chr), is_digit);
+            ASSERT_EQUAL(isLetter(chr), is_uc_letter || is_lc_letter);
+            ASSERT_EQUAL(isLetterOrDigit(chr), is_uc_letter || is_lc_letter || is_digit);
+
+            auto is_hexadecimal =
+                is_digit || (code >= 'a' && code <= 'f') || (code >= 'A' && code <= 'F');
+            ASSERT_EQUAL(HexadecimalCharsToInt<CharT>[chr] != NotADigit, is_hexadecimal);
+        }
+
+        ASSERT_FALSE(isLayout(static_cast<CharT>(-1)));
+        ASSERT_EQUAL(HexadecimalCharsToInt<CharT>[static_cast<CharT>(-1)], NotADigit);
+
+        return true;
+    }
+
     auto testChar() -> int
     {
         CERBERUS_TEST(testChar2Hex());
         CERBERUS_TEST(testU16Char2Hex());
+        CERBERUS_TEST(testCharKinds<char>());
+        CERBERUS_TEST(testCharKinds<char16_t>());
+        CERBERUS_TEST(testCharKinds<char32_t>());
 
         return 0;
     }
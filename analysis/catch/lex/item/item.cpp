@@ -65,7 +65,7 @@ namespace cerb::debug
         ASSERT_EQUAL(items.size(), 1);
 
         auto const &front_item = items.front();
-        auto const *string_item = dynamic_cast<StringItem<char> *>(front_item.get());
+        auto const *string_item = dynamic_cast<StringItem<char> *>(front_item);
 
         ASSERT_NOT_EQUAL(string_item, nullptr);
 
@@ -81,7 +81,7 @@ namespace cerb::debug
         ASSERT_EQUAL(items.size(), 2);
 
         auto const &front_item = items.front();
-        auto const *string_item = dynamic_cast<StringItem<char> *>(front_item.get());
+        auto const *string_item = dynamic_cast<StringItem<char> *>(front_item);
 
         ASSERT_NOT_EQUAL(string_item, nullptr);
 
@@ -91,7 +91,7 @@ namespace cerb::debug
         ASSERT_TRUE(string_item->flags.isSet(ItemFlags::REVERSE));
 
         auto const &back_item = items.back();
-        auto const *regex_item = dynamic_cast<RegexItem<char> *>(back_item.get());
+        auto const *regex_item = dynamic_cast<RegexItem<char> *>(back_item);
 
         ASSERT_NOT_EQUAL(regex_item, nullptr);
 
@@ -108,26 +108,47 @@ namespace cerb::debug
         ASSERT_EQUAL(items.size(), 2);
 
         auto const &front_item = items.front();
-        auto const *parsing_item = dynamic_cast<DotItem<char> *>(front_item.get());
+        auto const *parsing_item = dynamic_cast<DotItem<char> *>(front_item);
 
         ASSERT_NOT_EQUAL(parsing_item, nullptr);
 
         ASSERT_TRUE(parsing_item->flags.isSet(ItemFlags::PLUS));
 
         auto const &back_item = items.back();
-        auto const *regex_item = dynamic_cast<RegexItem<char> *>(back_item.get());
+        auto const *regex_item = dynamic_cast<RegexItem<char> *>(back_item);
 
         ASSERT_NOT_EQUAL(regex_item, nullptr);
 
         ASSERT_TRUE(regex_item->flags.isSet(ItemFlags::PLUS));
     }
 
+    auto testDeeplyNestedDotItem() -> void
+    {
+        constexpr size_t depth = 300;
+
+        AnalysisGlobals<char> parameters{};
+        auto rule = std::string(depth, '(') + "\"a\"" + std::string(depth, ')');
+        DotItem<char> item{ parameters, 4, rule };
+
+        auto const *nested_item = &item;
+
+        for (size_t i = 0; i != depth; ++i) {
+            ASSERT_EQUAL(nested_item->getItems().size(), 1);
+            nested_item = dynamic_cast<DotItem<char> *>(nested_item->getItems().front());
+            ASSERT_NOT_EQUAL(nested_item, nullptr);
+        }
+
+        auto const *string_item = dynamic_cast<StringItem<char> *>(nested_item->getItems().front());
+        ASSERT_NOT_EQUAL(string_item, nullptr);
+    }
+
     auto testDotItem() -> int
     {
         testDotItemOnNonTerminal();
         testDotItemOnString();
         testDotItemOnStringAndRegex();
         testComplexDotItem();
+        testDeeplyNestedDotItem();
         testDotItemCreationOnErrorCases();
         return 0;
     }
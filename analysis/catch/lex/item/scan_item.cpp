@@ -0,0 +1,75 @@
+#include <cerberus/debug/debug.hpp>
+#include <cerberus/lex/item/scan_item.hpp>
+
+namespace cerb::debug
+{
+    using namespace lex;
+
+    auto expectMatch(cerb::string_view rule, cerb::string_view text, size_t expected_length)
+        -> void
+    {
+        AnalysisGlobals<char> parameters{};
+        DotItem<char> item{ parameters, 0, rule };
+        ScanItemTree<char> tree{ item };
+
+        ASSERT_EQUAL(tree.match(text), expected_length);
+    }
+
+    auto testScanItemTreeLayout() -> void
+    {
+        AnalysisGlobals<char> parameters{};
+        DotItem<char> item{ parameters, 0, "([b-c]\"a\")*\"d\"" };
+        ScanItemTree<char> tree{ item };
+        auto const &items = tree.getItems();
+
+        ASSERT_EQUAL(items.size(), 5);
+
+        auto const &root = std::get<SequenceScanItem>(items[0].value);
+        ASSERT_EQUAL(root.first_child, 1);
+        ASSERT_EQUAL(root.number_of_children, 2);
+
+        auto const &nested = std::get<SequenceScanItem>(items[1].value);
+        ASSERT_EQUAL(nested.first_child, 3);
+        ASSERT_EQUAL(nested.number_of_children, 2);
+        ASSERT_TRUE(items[1].flags.isSet(ItemFlags::STAR));
+
+        auto const &regex = std::get<RegexScanItem>(items[3].value);
+
+        ASSERT_TRUE(tree.getString(std::get<StringScanItem>(items[2].value)).strView() == "d");
+        ASSERT_TRUE(tree.getAvailableChars(regex).at('c'));
+        ASSERT_TRUE(tree.getString(std::get<StringScanItem>(items[4].value)).strView() == "a");
+    }
+
+    auto testScanItemTreeOnNonterminal() -> void
+    {
+        AnalysisGlobals<char> parameters{};
+        DotItem<char> item{ parameters, 0, "\'+\'" };
+        ScanItemTree<char> tree{ item };
+
+        ASSERT_TRUE(tree.isNonterminal());
+        ASSERT_TRUE(tree.getNonterminal().strView() == "+");
+        ASSERT_EQUAL(tree.match("+"), ScanItemTree<char>::npos);
+        ASSERT_EQUAL(tree.match(""), ScanItemTree<char>::npos);
+    }
+
+    auto testScanItemTree() -> int
+    {
+        testScanItemTreeLayout();
+        testScanItemTreeOnNonterminal();
+
+        expectMatch("[0-9]+\".\"[0-9]*", "1010.01 + 1", 7);
+        expectMatch("[0-9]+\".\"[0-9]*", "1010.", 5);
+        expectMatch("[0-9]+\".\"[0-9]*", "1010", ScanItemTree<char>::npos);
+        expectMatch("[0-9]+\".\"[0-9]*", ".5", ScanItemTree<char>::npos);
+
+        expectMatch("([b-c]\"a\")*\"d\"", "bacad", 5);
+        expectMatch("([b-c]\"a\")*\"d\"", "d", 1);
+        expectMatch("([b-c]\"a\")*\"d\"", "bacd", ScanItemTree<char>::npos);
+
+        expectMatch("[0-9]?\"x\"", "x", 1);
+        expectMatch("[0-9]?\"x\"", "5x", 2);
+        expectMatch("[0-9]?\"x\"", "", ScanItemTree<char>::npos);
+
+        return 0;
+    }
+}// namespace cerb::debug
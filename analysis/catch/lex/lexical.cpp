@@ -6,8 +6,10 @@ namespace cerb::debug
     auto testStringToCodes() -> int;
 
     auto testDotItem() -> int;
+    auto testScanItemTree() -> int;
     auto testRegexParser() -> int;
     auto testBracketFinder() -> int;
+    auto testCommentSkipper() -> int;
 }// namespace cerb::debug
 
 auto main() -> int
@@ -20,8 +22,10 @@ auto main() -> int
     testStringToCodes();
 
     testDotItem();
+    testScanItemTree();
     testRegexParser();
     testBracketFinder();
+    testCommentSkipper();
 
     return 0;
 }
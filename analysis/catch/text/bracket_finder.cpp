@@ -1,10 +1,12 @@
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/text/bracket_finder.hpp>
+#include <cerberus/text/bracket_table.hpp>
 
 namespace cerb::debug
 {
     using namespace lex;
     using namespace text;
+    using namespace string_view_literals;
 
     static constexpr string_view TestInput = "(Hello, World())!";
     static constexpr u16string_view TestInputU16 = u"(Hello, World())!";
@@ -51,8 +53,51 @@ namespace cerb::debug
         return true;
     }
 
+    auto testBracketFinderWithDiagnostics() -> void
+    {
+        Diagnostics diagnostics{};
+
+        GeneratorForText<char> unclosed_bracket{ ErroneousTestInput };
+        unclosed_bracket.setDiagnostics(diagnostics);
+        ASSERT_EQUAL(findBracket('(', ')', unclosed_bracket), ErroneousTestInput.size());
+
+        GeneratorForText<char> no_bracket{ TestInput };
+        no_bracket.setDiagnostics(diagnostics);
+        ASSERT_EQUAL(findBracket('[', ']', no_bracket), 0U);
+
+        ASSERT_EQUAL(diagnostics.size(), 2U);
+        ASSERT_EQUAL(diagnostics.getDiagnostics()[0].message.strView(), "Unexpected EoF!");
+        ASSERT_EQUAL(
+            diagnostics.getDiagnostics()[1].message.strView(), "Unable to find starting bracket!");
+    }
+
+    auto testBracketTable() -> void
+    {
+        constexpr string_view input = "(a(b)(c(d)e)) ) ((f)"_sv;
+        BracketTable<char> bracket_table{ input, '(', ')' };
+
+        for (size_t i = 0; i != input.size(); ++i) {
+            if (input[i] != '(') {
+                ASSERT_EQUAL(bracket_table.findClosingBracket(i), BracketTable<char>::npos);
+                continue;
+            }
+
+            GeneratorForText<char> generator{ input };
+            generator.skip(i + 1);
+
+            try {
+                auto length = findBracket('(', ')', generator);
+                ASSERT_EQUAL(bracket_table.findClosingBracket(i), i + length);
+            } catch (BracketFinderError const &) {
+                ASSERT_EQUAL(bracket_table.findClosingBracket(i), BracketTable<char>::npos);
+            }
+        }
+    }
+
     auto testBracketFinder() -> int
     {
+        testBracketTable();
+        testBracketFinderWithDiagnostics();
         CERBERUS_TEST_STD_STRING(testBracketFinderOnBasicString());
         CERBERUS_TEST_STD_STRING(testBracketFinderOnU16String());
 
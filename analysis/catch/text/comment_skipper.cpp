@@ -0,0 +1,93 @@
+#include <cerberus/debug/debug.hpp>
+#include <cerberus/text/scan_api_modules/comment_skipper.hpp>
+#include <optional>
+
+namespace cerb::debug
+{
+    using namespace lex;
+    using namespace text;
+    using namespace string_view_literals;
+
+    auto testMultilineCommentSkipping() -> void
+    {
+        GeneratorForText<char> text_generator{ "a/* comment * / */b"_sv };
+        CommentSkipper<char> comment_skipper{ text_generator, "//"_sv, "/*"_sv, "*/"_sv };
+
+        ASSERT_EQUAL(text_generator.getRawChar(), 'a');
+        ASSERT_EQUAL(text_generator.getRawChar(), '/');
+
+        comment_skipper.skipComment();
+
+        ASSERT_EQUAL(text_generator.getCurrentChar(), '/');
+        ASSERT_EQUAL(text_generator.getRawChar(), 'b');
+    }
+
+    auto testUnterminatedCommentSkipping() -> void
+    {
+        GeneratorForText<char> text_generator{ "a/* comment * /"_sv };
+        CommentSkipper<char> comment_skipper{ text_generator, "//"_sv, "/*"_sv, "*/"_sv };
+
+        ASSERT_EQUAL(text_generator.getRawChar(), 'a');
+        ASSERT_EQUAL(text_generator.getRawChar(), '/');
+
+        try {
+            comment_skipper.skipComment();
+            CANT_BE_REACHED;
+        } catch (CommentSkipperException<char> const &error) {
+            ASSERT_NOT_EQUAL(error.getMessage().find("Unterminated comment."), std::string::npos);
+            ASSERT_EQUAL(error.getOffset(), 1U);
+        }
+    }
+
+    auto testUnterminatedCommentWithDiagnostics() -> void
+    {
+        Diagnostics diagnostics{};
+        GeneratorForText<char> text_generator{ "a/* comment * /"_sv };
+        CommentSkipper<char> comment_skipper{ text_generator, "//"_sv, "/*"_sv, "*/"_sv };
+
+        text_generator.setDiagnostics(diagnostics);
+        text_generator.skip(2);
+        comment_skipper.skipComment();
+
+        ASSERT_TRUE(lex::isEoF(text_generator.getCurrentChar()));
+        ASSERT_EQUAL(diagnostics.size(), 1U);
+        ASSERT_EQUAL(diagnostics.getDiagnostics().front().offset, 1U);
+    }
+
+    auto testErrorMessageAfterGeneratorIsDestroyed() -> void
+    {
+        auto text = "first line\nsecond /* never ends"_sv;
+        auto error = std::optional<CommentSkipperException<char>>{};
+
+        {
+            GeneratorForText<char> text_generator{ text };
+            text_generator.skip(19);
+
+            error.emplace("Unterminated comment.", text_generator);
+        }
+
+        ASSERT_EQUAL(error->getOffset(), 18U);
+        ASSERT_EQUAL(error->getLine(), 2U);
+        ASSERT_TRUE(error->getMessage().ends_with("\nsecond /* never ends\n       ^"));
+        ASSERT_EQUAL(std::string_view{ error->what() }, error->getMessage());
+    }
+
+    auto testErrorMessageAtTheBeginOfText() -> void
+    {
+        GeneratorForText<char16_t> text_generator{ u"abc"_sv };
+        CommentSkipperException<char16_t> error{ "Unterminated comment.", text_generator };
+
+        ASSERT_TRUE(error.getMessage().ends_with(u"\nabc\n^"));
+        ASSERT_NOT_EQUAL(std::string_view{ error.what() }.find("Warning!"), std::string::npos);
+    }
+
+    auto testCommentSkipper() -> int
+    {
+        testMultilineCommentSkipping();
+        testUnterminatedCommentSkipping();
+        testUnterminatedCommentWithDiagnostics();
+        testErrorMessageAfterGeneratorIsDestroyed();
+        testErrorMessageAtTheBeginOfText();
+        return 0;
+    }
+}// namespace cerb::debug
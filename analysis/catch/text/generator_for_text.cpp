@@ -68,7 +68,7 @@ namespace cerb::debug
         for (size_t i : Range(expected_text.size())) {
             char chr = text_generator.getCleanChar();
             ASSERT_EQUAL(chr, expected_text[i]);
-            ASSERT_EQUAL(text_generator.getTabsAndSpaces(), expected_tabs_and_spaces[i]);
+            ASSERT_EQUAL(text_generator.getTabsAndSpaces().strView(), expected_tabs_and_spaces[i]);
         }
 
         ASSERT_EQUAL(text_generator.getCleanChar(), '\0');
@@ -78,10 +78,157 @@ namespace cerb::debug
         return true;
     }
 
+    auto testGeneratorForTextCancellation() -> void
+    {
+        constexpr size_t check_interval = 1024;
+
+        std::string input(check_interval * 4, 'a');
+        std::stop_source stop_source{};
+        CancellationToken token{ stop_source.get_token() };
+        GeneratorForText<char> text_generator{ input };
+        size_t scanned_chars = 0;
+
+        text_generator.setCancellationToken(token, check_interval);
+        stop_source.request_stop();
+
+        try {
+            while (not isEoF(text_generator.getRawChar())) {
+                ++scanned_chars;
+            }
+            CANT_BE_REACHED;
+        } catch (OperationCancelledError const &error) {
+            ASSERT_EQUAL(std::string_view(error.what()), "Operation has been cancelled!");
+        }
+
+        ASSERT_EQUAL(scanned_chars, check_interval - 1);
+    }
+
+    template<typename Skip>
+    auto testGeneratorForTextSkip(Skip &&skip, string_view targets) -> void
+    {
+        constexpr string_view input =
+            "first line\n  \tsecond {line}\n\n    third [line] \t with (brackets)\nlast"_sv;
+
+        GeneratorForText<char> skipping_generator{ input, "None" };
+        GeneratorForText<char> reference_generator{ input, "None" };
+
+        while (true) {
+            char skipped_to = skip(skipping_generator);
+            char chr = reference_generator.getRawChar();
+
+            while (not isEoF(chr) && targets.find(chr) == string_view::npos) {
+                chr = reference_generator.getRawChar();
+            }
+
+            ASSERT_EQUAL(skipped_to, chr);
+            ASSERT_EQUAL(skipping_generator.getCurrentChar(), chr);
+            ASSERT_EQUAL(skipping_generator.charOffset(), reference_generator.charOffset());
+            ASSERT_EQUAL(skipping_generator.line(), reference_generator.line());
+            ASSERT_EQUAL(skipping_generator.charPosition(), reference_generator.charPosition());
+            ASSERT_EQUAL(skipping_generator.getCurrentLine(), reference_generator.getCurrentLine());
+            ASSERT_EQUAL(
+                skipping_generator.getTabsAndSpaces(), reference_generator.getTabsAndSpaces());
+
+            if (isEoF(chr)) {
+                break;
+            }
+        }
+    }
+
+    auto testGeneratorForTextSkipping() -> void
+    {
+        constexpr string_view brackets = "{}[]()"_sv;
+        constexpr string_view whitespaces = " \t\n"_sv;
+
+        testGeneratorForTextSkip(
+            [brackets](GeneratorForText<char> &generator) {
+                return generator.skipToAnyOf(brackets);
+            },
+            brackets);
+
+        testGeneratorForTextSkip(
+            [whitespaces](GeneratorForText<char> &generator) {
+                return generator.skipToClass(CharClass{ whitespaces });
+            },
+            whitespaces);
+    }
+
+    static_assert(std::is_trivially_copyable_v<GeneratorForText<char>>);
+
+    auto testGeneratorForTextForkAt(GeneratorForText<char> const &generator, size_t from, size_t to)
+        -> void
+    {
+        auto forked_generator = generator.fork(from, to);
+        auto reference_generator = generator;
+
+        for (size_t i = 0; i != from; ++i) {
+            reference_generator.getRawChar();
+        }
+
+        ASSERT_EQUAL(forked_generator.isInitialized(), reference_generator.isInitialized());
+        ASSERT_EQUAL(forked_generator.charOffset(), reference_generator.charOffset());
+        ASSERT_EQUAL(forked_generator.line(), reference_generator.line());
+        ASSERT_EQUAL(forked_generator.charPosition(), reference_generator.charPosition());
+        ASSERT_EQUAL(forked_generator.getCurrentLine(), reference_generator.getCurrentLine());
+        ASSERT_EQUAL(forked_generator.getTabsAndSpaces(), reference_generator.getTabsAndSpaces());
+        ASSERT_EQUAL(forked_generator.getText().size(), generator.charOffset() + to);
+    }
+
+    auto testGeneratorForTextFork() -> void
+    {
+        constexpr size_t max_fork_offset = 6;
+        constexpr string_view input = "first (line)\n  \t(second {line}\n)\n \t  third"_sv;
+
+        GeneratorForText<char> generator{ input, "None" };
+
+        for (size_t from = 1; from != max_fork_offset; ++from) {
+            testGeneratorForTextForkAt(generator, from, input.size() - 1);
+        }
+
+        while (not isEoF(generator.getRawChar())) {
+            auto offset = generator.charOffset();
+            auto fork_end = input.size() - offset - 1;
+
+            for (size_t from = 1; from != max_fork_offset && offset + from < input.size(); ++from) {
+                testGeneratorForTextForkAt(generator, from, fork_end);
+            }
+        }
+    }
+
+    auto testGeneratorForTextRawSkip() -> void
+    {
+        constexpr string_view input = "one\n  two\n\n \tthree\0after eof"_sv;
+
+        for (size_t times = 0; times != input.size() + 2; ++times) {
+            GeneratorForText<char> skipping_generator{ input, "None" };
+            GeneratorForText<char> reference_generator{ input, "None" };
+
+            skipping_generator.getRawChar();
+            reference_generator.getRawChar();
+
+            skipping_generator.skip(times);
+
+            for (size_t i = 0; i != times; ++i) {
+                reference_generator.getRawChar();
+            }
+
+            ASSERT_EQUAL(skipping_generator.charOffset(), reference_generator.charOffset());
+            ASSERT_EQUAL(skipping_generator.line(), reference_generator.line());
+            ASSERT_EQUAL(skipping_generator.charPosition(), reference_generator.charPosition());
+            ASSERT_EQUAL(skipping_generator.getCurrentLine(), reference_generator.getCurrentLine());
+            ASSERT_EQUAL(
+                skipping_generator.getTabsAndSpaces(), reference_generator.getTabsAndSpaces());
+        }
+    }
+
     auto testGeneratorForText() -> int
     {
         CERBERUS_TEST_STD_STRING(testRawGeneratorForText());
         CERBERUS_TEST_STD_STRING(testCleanGeneratorForText());
+        testGeneratorForTextCancellation();
+        testGeneratorForTextSkipping();
+        testGeneratorForTextFork();
+        testGeneratorForTextRawSkip();
         return 0;
     }
 }// namespace cerb::debug
@@ -50,8 +50,50 @@ namespace cerb::debug
         return processed_string == ExpectedOutputU16;
     }
 
+    auto testStringToCodesWithDiagnostics() -> void
+    {
+        Diagnostics diagnostics{};
+
+        GeneratorForText<char> unterminated_string{ "\"Hello\\"_sv };
+        unterminated_string.setDiagnostics(diagnostics);
+        ASSERT_EQUAL(convertStringToCodes('\"', unterminated_string), "Hello");
+
+        GeneratorForText<char> string_without_opener{ "Hello\""_sv };
+        string_without_opener.setDiagnostics(diagnostics);
+        ASSERT_TRUE(convertStringToCodes('\"', string_without_opener).empty());
+
+        auto const &errors = diagnostics.getDiagnostics();
+
+        ASSERT_EQUAL(errors.size(), 2U);
+        ASSERT_EQUAL(errors[0].message.strView(), "Unexpected EoF!");
+        ASSERT_EQUAL(errors[0].offset, 7U);
+        ASSERT_EQUAL(errors[1].message.strView(), "Unable to open string!");
+        ASSERT_EQUAL(errors[1].offset, 0U);
+    }
+
+    auto testStringToCodesLocation() -> void
+    {
+        constexpr string_view input = "\"first line\n\tsecond \\\"line\\\" end\" tail"_sv;
+
+        GeneratorForText<char> text_generator{ input };
+        GeneratorForText<char> reference_generator{ input };
+
+        ASSERT_EQUAL(
+            convertStringToCodes('\"', text_generator), "first line\n\tsecond \"line\" end");
+
+        while (reference_generator.charOffset() != input.rfind('\"')) {
+            reference_generator.getRawChar();
+        }
+
+        ASSERT_EQUAL(text_generator.charOffset(), reference_generator.charOffset());
+        ASSERT_EQUAL(text_generator.line(), reference_generator.line());
+        ASSERT_EQUAL(text_generator.charPosition(), reference_generator.charPosition());
+    }
+
     auto testStringToCodes() -> int
     {
+        testStringToCodesLocation();
+        testStringToCodesWithDiagnostics();
         ASSERT_TRUE(testStringToCodesOnEmptyBasicString());
         ASSERT_TRUE(testStringToCodesOnBasicString());
         ASSERT_TRUE(testStringToCodesOnUtf16String());
@@ -3,9 +3,9 @@
 
 #include <cerberus/analysis/analysis_basic_exception.hpp>
 #include <cerberus/format/format.hpp>
-#include <cerberus/reference_wrapper.hpp>
 #include <cerberus/text/generator_for_text.hpp>
 #include <cerberus/text/string_reducer.hpp>
+#include <mutex>
 
 #define CERBERUS_ANALYSIS_EXCEPTION(name, CharT, from)                                             \
     struct name : public cerb::analysis::AnalysisException<CharT, from>                            \
@@ -19,52 +19,54 @@
 
 namespace cerb::analysis
 {
+    // Exception keeps only the location of the error and views of the text, so throwing it is
+    // cheap. Message with the reduced line and the arrow is formatted on the first call of
+    // getMessage() or what(), once even if threads share the exception through an exception_ptr.
+    // Text of the generator must outlive the exception, the generator itself may be destroyed.
     template<CharacterLiteral CharT, CerberusExceptionType ExceptionT = BasicAnalysisException>
     struct AnalysisException : public ExceptionT
     {
         CERBLIB_DECL auto getOffset() const -> size_t
         {
-            return text_generator.charOffset();
+            return offset;
         }
 
         CERBLIB_DECL auto getLine() const -> size_t
         {
-            return text_generator.line();
+            return line_number;
         }
 
         CERBLIB_DECL auto getCharPosition() const -> size_t
         {
-            return text_generator.charPosition();
+            return char_position;
         }
 
         CERBLIB_DECL auto getFilename() const -> BasicStringView<char> const &
         {
-            return text_generator.filename();
-        }
-
-        CERBLIB_DECL auto getTabsAndSpaces() const -> std::basic_string<CharT> const &
-        {
-            return text_generator.getTabsAndSpaces();
+            return filename;
         }
 
         CERBLIB_DECL auto getText() const -> BasicStringView<CharT> const &
         {
-            return text_generator.getText();
+            return text;
         }
 
         CERBLIB_DECL auto getCurrentLine() const -> BasicStringView<CharT> const &
         {
-            return text_generator.getCurrentLine();
+            return current_line;
         }
 
         CERBLIB_DECL auto getRestOfTheText() const -> BasicStringView<CharT>
         {
-            return text_generator.getRestOfTheText();
+            return { text.begin() + min(offset, text.size()), text.end() };
         }
 
-        CERBLIB_DECL auto getMessage() const -> std::basic_string<CharT> const &
+        [[nodiscard]] auto getMessage() const -> std::basic_string<CharT> const &
         {
-            return message;
+            std::call_once(
+                cache.message_flag, [this]() { cache.message = formatErrorMessage(); });
+
+            return cache.message;
         }
 
         AnalysisException() noexcept = default;
@@ -72,47 +74,72 @@ namespace cerb::analysis
         explicit constexpr AnalysisException(
             string_view const &exception_message,
             text::GeneratorForText<CharT> const &generator)
-          : text_generator(generator),
-            basic_char_message(getNonCharErrorMessage(exception_message)),
-            message(getErrorMessage(exception_message))
+          : ExceptionT(exception_message.strView()), text(generator.getText()),
+            current_line(generator.getCurrentLine()), filename(generator.filename()),
+            offset(generator.charOffset()), line_number(generator.line()),
+            char_position(generator.charPosition())
         {}
 
         [[nodiscard]] auto what() const noexcept -> char const * override
         {
-            if constexpr (std::is_same_v<char, CharT>) {
-                return message.c_str();
-            } else {
-                return basic_char_message.c_str();
+            try {
+                if constexpr (std::is_same_v<char, CharT>) {
+                    return getMessage().c_str();
+                } else {
+                    std::call_once(cache.basic_char_message_flag, [this]() {
+                        cache.basic_char_message = formatNonCharErrorMessage();
+                    });
+
+                    return cache.basic_char_message.c_str();
+                }
+            } catch (...) {
+                return ExceptionT::what();
             }
         }
 
     private:
-        auto getNonCharErrorMessage(string_view const &exception_message) -> std::string const &
+        // copies of the exception format their own messages, because flags can't be copied
+        struct MessageCache
+        {
+            MessageCache() = default;
+
+            constexpr MessageCache(MessageCache const & /*unused*/) noexcept
+            {}
+
+            constexpr MessageCache(MessageCache && /*unused*/) noexcept
+            {}
+
+            ~MessageCache() = default;
+
+            auto operator=(MessageCache const &) -> MessageCache & = delete;
+            auto operator=(MessageCache &&) noexcept -> MessageCache & = delete;
+
+            std::once_flag message_flag{};
+            std::once_flag basic_char_message_flag{};
+            std::basic_string<CharT> message{};
+            std::string basic_char_message{};
+        };
+
+        [[nodiscard]] auto formatNonCharErrorMessage() const -> std::string
         {
             using namespace string_view_literals;
 
-            if constexpr (not std::is_same_v<char, CharT>) {
-                static const std::string temporary_message = fmt::format<char>(
-                    "{}\n"
-                    "Warning! Character type is {} instead of {}, so error message might have some "
-                    "defects. Please use getMessage() instead.\n"_sv,
-                    getErrorMessage(exception_message), typeid(CharT).name(), typeid(char).name());
-                return temporary_message;
-            } else {
-                static const std::string temporary_message{};
-                return temporary_message;
-            }
+            return fmt::format<char>(
+                "{}\n"
+                "Warning! Character type is {} instead of {}, so error message might have some "
+                "defects. Please use getMessage() instead.\n"_sv,
+                getMessage(), typeid(CharT).name(), typeid(char).name());
         }
 
-        auto getErrorMessage(string_view const &exception_message) -> std::basic_string<CharT>
+        [[nodiscard]] auto formatErrorMessage() const -> std::basic_string<CharT>
         {
             using namespace string_view_literals;
 
-            text::StringReducer<CharT> reducer{ text_generator };
+            text::StringReducer<CharT> reducer{ current_line, getErrorPositionInLine() };
 
             std::basic_string<CharT> result = fmt::format<CharT>(
                 "Analysis error occurred: {} File: {}, line: {}, char: {}\n{}\n"_sv,
-                exception_message, getFilename(), getLine(), getCharPosition(),
+                ExceptionT::message, filename, line_number, char_position,
                 reducer.getReducedString());
 
             addArrowToTheMessage(result, reducer.getErrorPositionAfterReducing());
@@ -120,15 +147,26 @@ namespace cerb::analysis
             return result;
         }
 
-        static auto addArrowToTheMessage(std::basic_string<CharT> &result, size_t offset) -> void
+        CERBLIB_DECL auto getErrorPositionInLine() const -> size_t
+        {
+            auto line_begin = static_cast<size_t>(current_line.begin() - text.begin());
+            return offset > line_begin ? offset - line_begin : 0;
+        }
+
+        static auto addArrowToTheMessage(std::basic_string<CharT> &result, size_t offset_in_line)
+            -> void
         {
-            result.resize(result.size() + offset + 1, static_cast<CharT>(' '));
+            result.resize(result.size() + offset_in_line, static_cast<CharT>(' '));
             result.push_back(static_cast<CharT>('^'));
         }
 
-        text::GeneratorForText<CharT> const &text_generator;
-        std::string basic_char_message{};
-        std::basic_string<CharT> message{};
+        BasicStringView<CharT> text{};
+        BasicStringView<CharT> current_line{};
+        BasicStringView<char> filename{};
+        size_t offset{};
+        size_t line_number{};
+        size_t char_position{};
+        mutable MessageCache cache{};
     };
 
 #ifndef CERBERUS_HEADER_ONLY
@@ -2,8 +2,8 @@
 #define CERBERUS_CHAR_HPP
 
 #include <cerberus/cerberus.hpp>
+#include <cerberus/char_table.hpp>
 #include <cerberus/enum.hpp>
-#include <cerberus/flat_map.hpp>
 
 #define CCHAR(x) static_cast<CharT>(x)
 
@@ -16,15 +16,39 @@ namespace cerb::lex
         Underscore = CCHAR('_'), DQM = CCHAR('\"'), Apostrophe = CCHAR('\''),
         Backlash = CCHAR('\\'));
 
+    // NOLINTNEXTLINE
+    CERBERUS_ENUM(CharKind, u8, LAYOUT = 1U, DIGIT = 2U, UC_LETTER = 4U, LC_LETTER = 8U);
+
+    // value of hexadecimal digits, other chars are mapped to NotADigit
+    constexpr u16 NotADigit = std::numeric_limits<u16>::max();
+
     template<CharacterLiteral CharT>
-    constexpr FlatMap<CharT, u16, 22> HexadecimalCharsToInt{
-        { CCHAR('0'), 0 },  { CCHAR('1'), 1 },  { CCHAR('2'), 2 },  { CCHAR('3'), 3 },
-        { CCHAR('4'), 4 },  { CCHAR('5'), 5 },  { CCHAR('6'), 6 },  { CCHAR('7'), 7 },
-        { CCHAR('8'), 8 },  { CCHAR('9'), 9 },  { CCHAR('a'), 10 }, { CCHAR('b'), 11 },
-        { CCHAR('c'), 12 }, { CCHAR('d'), 13 }, { CCHAR('e'), 14 }, { CCHAR('f'), 15 },
-        { CCHAR('A'), 10 }, { CCHAR('B'), 11 }, { CCHAR('C'), 12 }, { CCHAR('D'), 13 },
-        { CCHAR('E'), 14 }, { CCHAR('F'), 15 }
-    };
+    constexpr auto HexadecimalCharsToInt = []() {
+        CharTable<CharT, u16> table{ NotADigit };
+
+        for (u16 i = 0; i != 10; ++i) {// NOLINT
+            table.set(CCHAR('0' + i), i);
+        }
+
+        for (u16 i = 0; i != 6; ++i) {// NOLINT
+            table.set(CCHAR('a' + i), static_cast<u16>(i + 10));// NOLINT
+            table.set(CCHAR('A' + i), static_cast<u16>(i + 10));// NOLINT
+        }
+
+        return table;
+    }();
+
+    template<CharacterLiteral CharT>
+    constexpr auto CharKinds = []() {
+        CharTable<CharT, u8> table{};
+
+        table.setRange(CCHAR('\x01'), CharEnum<CharT>::Space, CharKind::LAYOUT);
+        table.setRange(CCHAR('0'), CCHAR('9'), CharKind::DIGIT);
+        table.setRange(CCHAR('A'), CCHAR('Z'), CharKind::UC_LETTER);
+        table.setRange(CCHAR('a'), CCHAR('z'), CharKind::LC_LETTER);
+
+        return table;
+    }();
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isEoF(CharT chr) -> bool
@@ -32,40 +56,46 @@ namespace cerb::lex
         return chr == CharEnum<CharT>::EoF;
     }
 
+    template<CharacterLiteral CharT>
+    CERBLIB_DECL auto isCharOfKind(CharT chr, CharKind kind) -> bool
+    {
+        return CharKind{ CharKinds<CharT>[chr] }.isAnyOfSet(kind);
+    }
+
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isLayout(CharT chr) -> bool
     {
-        return logicalAnd(chr > CharEnum<CharT>::EoF, chr <= CharEnum<CharT>::Space);
+        return isCharOfKind(chr, CharKind::LAYOUT);
     }
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isDigit(CharT chr) -> bool
     {
-        return logicalAnd(chr >= CCHAR('0'), chr <= CCHAR('9'));
+        return isCharOfKind(chr, CharKind::DIGIT);
     }
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isUcLetter(CharT chr) -> bool
     {
-        return logicalAnd(chr >= CCHAR('A'), chr <= CCHAR('Z'));
+        return isCharOfKind(chr, CharKind::UC_LETTER);
     }
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isLcLetter(CharT chr) -> bool
     {
-        return logicalAnd(chr >= CCHAR('a'), chr <= CCHAR('z'));
+        return isCharOfKind(chr, CharKind::LC_LETTER);
     }
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isLetter(CharT chr) -> bool
     {
-        return logicalOr(isUcLetter(chr), isLcLetter(chr));
+        return isCharOfKind(chr, CharKind::UC_LETTER | CharKind::LC_LETTER);
     }
 
     template<CharacterLiteral CharT>
     CERBLIB_DECL auto isLetterOrDigit(CharT chr) -> bool
     {
-        return logicalOr(isDigit(chr), isLetter(chr));
+        return isCharOfKind(chr, CharKind::UC_LETTER | CharKind::LC_LETTER | CharKind::DIGIT);
     }
 }// namespace cerb::lex
 
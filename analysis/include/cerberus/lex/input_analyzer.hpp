@@ -1,14 +1,14 @@
 #ifndef CERBERUS_INPUT_ANALYZER_HPP
 #define CERBERUS_INPUT_ANALYZER_HPP
 
-#include <cerberus/lex/item/item.hpp>
+#include <cerberus/lex/item/scan_item.hpp>
 
 namespace cerb::lex
 {
     template<CharacterLiteral CharT, CharacterLiteral CharForId = char>
     struct Rule
     {
-        std::vector<DotItem<CharT>> items{};
+        std::vector<ScanItemTree<CharT>> items{};
         BasicStringView<CharForId> name{};
     };
 
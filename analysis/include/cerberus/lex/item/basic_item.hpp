@@ -1,6 +1,7 @@
 #ifndef CERBERUS_BASIC_ITEM_HPP
 #define CERBERUS_BASIC_ITEM_HPP
 
+#include <cerberus/arena.hpp>
 #include <cerberus/lazy_executor.hpp>
 #include <cerberus/lex/lexical_analysis_exception.hpp>
 #include <cerberus/lex/token.hpp>
@@ -13,11 +14,10 @@
     using basic_item_t = BasicItem<CharT>;                                                         \
     using basic_item_t::analysis_globals;                                                          \
     using basic_item_t::cast;                                                                      \
-    using basic_item_t::flags;                                                                     \
-    using typename basic_item_t::ScanResult
+    using basic_item_t::flags
 
 #define CERBLIB_BASIC_ITEM_ARGS cerb::lex::AnalysisGlobals<CharT> &analysis_parameters
-#define CERBLIB_CONSTRUCT_BASIC_ITEM basic_item_t(analysis_parameters)
+#define CERBLIB_CONSTRUCT_BASIC_ITEM(kind) basic_item_t(analysis_parameters, kind)
 
 namespace cerb::lex
 {
@@ -25,8 +25,12 @@ namespace cerb::lex
         ItemFlags, u32, NONE = 0b0, STAR = 0b1, PLUS = 0b10, QUESTION = 0b1'00, FIXED = 0b1'000,
         PREFIX = 0b10'000, REVERSE = 0b100'000, NONTERMINAL = 0b10'000'000);
 
-    // NOLINTNEXTLINE
-    CERBERUS_ENUM(ScanResultStatus, u16, NONE = 0b0, SUCCESS = 0b1, FAILURE = 0b10);
+    enum struct ItemKind : u8
+    {
+        DOT,
+        STRING,
+        REGEX
+    };
 
     template<CharacterLiteral CharT>
     struct AnalysisGlobals
@@ -55,32 +59,27 @@ namespace cerb::lex
         AnalysisGlobals() = default;
 
         string_container_t nonterminals{};
+        Arena item_arena{};
         LazyExecutor<> lazy_executor{ 2 };
     };
 
     template<CharacterLiteral CharT>
     struct BasicItem
     {
-        struct ScanResult
-        {
-            ScanResultStatus status{};
-        };
-
         template<std::integral Int>
         CERBLIB_DECL static auto cast(Int value) -> CharT
         {
             return static_cast<CharT>(value);
         }
 
-        CERBLIB_DECL virtual auto scan(text::GeneratorForText<CharT>) const -> ScanResult = 0;
         virtual constexpr auto postInitializationSetup() -> void = 0;
 
         BasicItem() = default;
         BasicItem(BasicItem const &) = default;
         BasicItem(BasicItem &&) noexcept = default;
 
-        constexpr explicit BasicItem(AnalysisGlobals<CharT> &analysis_parameters)
-          : analysis_globals(analysis_parameters)
+        constexpr BasicItem(AnalysisGlobals<CharT> &analysis_parameters, ItemKind item_kind)
+          : analysis_globals(analysis_parameters), kind(item_kind)
         {}
 
         virtual ~BasicItem() = default;
@@ -90,6 +89,7 @@ namespace cerb::lex
 
         AnalysisGlobals<CharT> &analysis_globals;
         ItemFlags flags{ ItemFlags::NONE };
+        ItemKind kind{};
     };
 
     // NOLINTNEXTLINE
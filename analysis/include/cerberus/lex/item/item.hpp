@@ -6,6 +6,7 @@
 #include <cerberus/lex/item/regex.hpp>
 #include <cerberus/lex/item/string.hpp>
 #include <cerberus/text/bracket_finder.hpp>
+#include <cerberus/text/bracket_table.hpp>
 #include <utility>
 
 namespace cerb::lex
@@ -21,7 +22,7 @@ namespace cerb::lex
         friend DotItemChecks<CharT>;
 
         using Check = DotItemChecks<CharT>;
-        using item_ptr = std::unique_ptr<BasicItem<CharT>>;
+        using item_ptr = BasicItem<CharT> *;
 
         CERBLIB_DECL auto getId() const -> size_t
         {
@@ -33,10 +34,10 @@ namespace cerb::lex
             return items;
         }
 
-        CERBLIB_DECL auto scan(text::GeneratorForText<CharT> /*unused*/) const
-            -> ScanResult override
+        // text of the nonterminal, if the rule is one
+        CERBLIB_DECL auto getNonterminal() const -> std::basic_string<CharT> const &
         {
-            return ScanResult{};
+            return nonterminal;
         }
 
         CERBLIB_DECL auto operator==(DotItem const &other) const -> bool
@@ -52,21 +53,32 @@ namespace cerb::lex
         constexpr DotItem(
             AnalysisGlobals<CharT> &analysis_parameters, size_t id_of_item,
             BasicStringView<CharT> const &rule)
-          : CERBLIB_CONSTRUCT_BASIC_ITEM, scan_api_t(rule_generator), rule_generator(rule),
-            item_id(id_of_item)
+          : CERBLIB_CONSTRUCT_BASIC_ITEM(ItemKind::DOT), scan_api_t(rule_generator),
+            rule_generator(rule), rule_brackets(rule, cast('('), cast(')')),
+            bracket_table(&rule_brackets), item_id(id_of_item)
         {
             scan_api_t::beginScanning(CharEnum<CharT>::EoF);
         }
 
+        // brackets of nested items are taken from the table of the rule, which is used only
+        // during parsing
         constexpr DotItem(
             AnalysisGlobals<CharT> &analysis_parameters, size_t id_of_item,
-            text::GeneratorForText<CharT> const &gen)
-          : CERBLIB_CONSTRUCT_BASIC_ITEM, scan_api_t(rule_generator), rule_generator(gen),
-            item_id(id_of_item)
+            text::GeneratorForText<CharT> const &gen,
+            text::BracketTable<CharT> const &brackets_of_rule)
+          : CERBLIB_CONSTRUCT_BASIC_ITEM(ItemKind::DOT), scan_api_t(rule_generator),
+            rule_generator(gen), bracket_table(&brackets_of_rule), item_id(id_of_item)
         {
             scan_api_t::beginScanning(CharEnum<CharT>::EoF);
         }
 
+        // root item points to its own bracket table, so it must stay where it was built
+        DotItem(DotItem const &) = delete;
+        DotItem(DotItem &&) noexcept = delete;
+
+        auto operator=(DotItem const &) -> DotItem & = delete;
+        auto operator=(DotItem &&) noexcept -> DotItem & = delete;
+
     private:
         constexpr auto onStart() -> text::ScanApiStatus override
         {
@@ -168,7 +180,8 @@ namespace cerb::lex
             text::GeneratorForText<CharT> forked_gen =
                 rule_generator.fork(begin_item_length, item_length);
             auto *new_item =
-                Allocator<CharT>::newDotItem(analysis_globals, items, getId(), forked_gen);
+                Allocator<CharT>::newDotItem(
+                    analysis_globals, items, getId(), forked_gen, *bracket_table);
 
             Check::itemIsNotNonterminal(*new_item);
             skipItemBorder(item_length);
@@ -183,9 +196,8 @@ namespace cerb::lex
         {
             Check::nonTerminalCanBeAdded(*this);
 
-            std::basic_string<CharT> converted_str =
-                convertStringToCodes(cast('\''), rule_generator);
-            makeNonterminalGlobal(std::move(converted_str));
+            nonterminal = convertStringToCodes(cast('\''), rule_generator);
+            makeNonterminalGlobal(nonterminal);
 
             flags |= ItemFlags::NONTERMINAL;
         }
@@ -197,7 +209,14 @@ namespace cerb::lex
 
         CERBLIB_DECL auto getItemLength() const -> size_t
         {
-            return findBracket(cast('('), cast(')'), getGenerator());
+            auto offset = getGenerator().charOffset();
+            auto closing_bracket = bracket_table->findClosingBracket(offset);
+
+            if (closing_bracket == text::BracketTable<CharT>::npos) {
+                throw text::BracketFinderError("Unexpected EoF!");
+            }
+
+            return closing_bracket - offset;
         }
 
         constexpr auto completeLastItem() -> void
@@ -208,13 +227,16 @@ namespace cerb::lex
             }
         }
 
-        constexpr auto makeNonterminalGlobal(std::basic_string<CharT> &&str) -> void
+        constexpr auto makeNonterminalGlobal(std::basic_string<CharT> const &str) -> void
         {
-            analysis_globals.emplaceNonterminal(std::move(str), getId());
+            analysis_globals.emplaceNonterminal(str, getId());
         }
 
         text::GeneratorForText<CharT> rule_generator{};
+        text::BracketTable<CharT> rule_brackets{};
+        text::BracketTable<CharT> const *bracket_table{};
         SmallVector<item_ptr> items{};
+        std::basic_string<CharT> nonterminal{};
         size_t item_id{};
     };
 
@@ -2,14 +2,11 @@
 #define CERBERUS_ITEM_ALLOC_HPP
 
 #include <cerberus/lex/item/basic_item.hpp>
-#include <memory>
 
 #define BASIC_ITEM_CHART cerb::lex::BasicItem<CharT>
 
 namespace cerb::lex
 {
-    CERBERUS_EXCEPTION(AllocationError, CerberusException);
-
     namespace regex
     {
         template<CharacterLiteral CharT>
@@ -31,7 +28,7 @@ namespace cerb::lex
     template<CharacterLiteral CharT>
     struct Allocator
     {
-        using item_ptr = std::unique_ptr<BasicItem<CharT>>;
+        using item_ptr = BasicItem<CharT> *;
 
         template<typename... Ts>
         constexpr static auto newDotItem(
@@ -62,41 +59,17 @@ namespace cerb::lex
         Allocator() = default;
 
     private:
+        // items are owned by the arena of the analysis, so they live until the analyzer is gone
         template<ItemObject<CharT> ItemT, typename... Ts>
         CERBLIB_DECL static auto newItem(
             AnalysisGlobals<CharT> &analysis_globals, SmallVector<item_ptr> &items, Ts &&...args)
             -> ItemT *
         {
-            item_ptr new_item =
-                constructNewItem<ItemT>(analysis_globals, std::forward<Ts>(args)...);
-            items.emplace_back(std::move(new_item));
-
-            item_ptr &last_item = items.back();
-            return convertSmartPointerToAnOrdinary<ItemT>(last_item);
-        }
-
-        template<ItemObject<CharT> ItemT, typename... Ts>
-        CERBLIB_DECL static auto
-            constructNewItem(AnalysisGlobals<CharT> &analysis_globals, Ts &&...args) -> item_ptr
-        {
-            return std::make_unique<ItemT>(analysis_globals, std::forward<Ts>(args)...);
-        }
-
-        template<ItemObject<CharT> ItemT>
-        constexpr static auto convertSmartPointerToAnOrdinary(item_ptr &pointer) -> ItemT *
-        {
-            auto *casted_item = dynamic_cast<ItemT *>(pointer.get());
-            checkThatPointerIsNotNull(casted_item);
+            auto *new_item = analysis_globals.item_arena.template create<ItemT>(
+                analysis_globals, std::forward<Ts>(args)...);
 
-            return casted_item;
-        }
-
-        template<ItemObject<CharT> ItemT>
-        constexpr static auto checkThatPointerIsNotNull(ItemT const *item) -> void
-        {
-            if (item == nullptr) {
-                throw AllocationError("Unable to allocate new item.");
-            }
+            items.emplace_back(new_item);
+            return new_item;
         }
     };
 }// namespace cerb::lex
@@ -11,14 +11,13 @@ namespace cerb::lex::regex
     {
         CERBLIB_BASIC_ITEM_ACCESS(CharT);
 
-        CERBLIB_DECL auto scan(text::GeneratorForText<CharT> /*unused*/) const
-            -> ScanResult override
+        CERBLIB_DECL auto getAvailableChars() const -> Bitmap const &
         {
-            return ScanResult{};
+            return available_chars;
         }
 
         constexpr RegexItem(CERBLIB_BASIC_ITEM_ARGS, text::GeneratorForText<CharT> &regex_rule)
-          : CERBLIB_CONSTRUCT_BASIC_ITEM
+          : CERBLIB_CONSTRUCT_BASIC_ITEM(ItemKind::REGEX)
         {
             parseRegex(regex_rule);
         }
@@ -0,0 +1,216 @@
+#ifndef CERBERUS_SCAN_ITEM_HPP
+#define CERBERUS_SCAN_ITEM_HPP
+
+#include <cerberus/lex/item/item.hpp>
+#include <variant>
+
+namespace cerb::lex
+{
+    // string is stored in the string pool of the tree
+    struct StringScanItem
+    {
+        size_t offset{};
+        size_t length{};
+    };
+
+    struct RegexScanItem
+    {
+        size_t bitmap_index{};
+    };
+
+    // children of a sequence are stored one after another in the tree
+    struct SequenceScanItem
+    {
+        size_t first_child{};
+        size_t number_of_children{};
+    };
+
+    struct ScanItem
+    {
+        std::variant<StringScanItem, RegexScanItem, SequenceScanItem> value{};
+        ItemFlags flags{ ItemFlags::NONE };
+    };
+
+    // Finished item tree for the runtime path. Items are matched with static dispatch on their
+    // kind, so each kind is inlined into the matching loop. Root of the tree is the first item.
+    // Nonterminals are matched by AnalysisGlobals::nonterminals, so their trees keep only the
+    // text of the nonterminal and never match.
+    // Tree does not refer to the DotItem it was built from, so parsing state may be released.
+    template<CharacterLiteral CharT>
+    class ScanItemTree
+    {
+        using item_t = ScanItem;
+
+    public:
+        constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+        CERBLIB_DECL auto getItems() const -> std::vector<item_t> const &
+        {
+            return items;
+        }
+
+        CERBLIB_DECL auto isNonterminal() const -> bool
+        {
+            return items.empty();
+        }
+
+        CERBLIB_DECL auto getNonterminal() const -> BasicStringView<CharT>
+        {
+            return { nonterminal.data(), nonterminal.size() };
+        }
+
+        CERBLIB_DECL auto getString(StringScanItem const &item) const -> BasicStringView<CharT>
+        {
+            return { strings.data() + item.offset, item.length };
+        }
+
+        CERBLIB_DECL auto getAvailableChars(RegexScanItem const &item) const -> Bitmap const &
+        {
+            return bitmaps[item.bitmap_index];
+        }
+
+        // length of the match at the beginning of the text or npos. Every item takes as many
+        // repetitions as it can, there is no backtracking.
+        CERBLIB_DECL auto match(BasicStringView<CharT> const &text) const -> size_t
+        {
+            if (isNonterminal()) {
+                return npos;
+            }
+
+            return matchItem(items.front(), text, 0);
+        }
+
+        constexpr explicit ScanItemTree(DotItem<CharT> const &root)
+        {
+            if (root.flags.isSet(ItemFlags::NONTERMINAL)) {
+                nonterminal = root.getNonterminal();
+                return;
+            }
+
+            items.push_back({ SequenceScanItem{}, root.flags });
+            addChildren(0, root);
+
+            items.shrink_to_fit();
+            strings.shrink_to_fit();
+            bitmaps.shrink_to_fit();
+        }
+
+    private:
+        constexpr auto addChildren(size_t parent, DotItem<CharT> const &dot_item) -> void
+        {
+            auto const &children = dot_item.getItems();
+            auto first_child = items.size();
+
+            items[parent].value = SequenceScanItem{ first_child, children.size() };
+
+            for (auto const *child : children) {
+                items.push_back(convertItem(*child));
+            }
+
+            for (size_t i = 0; i != children.size(); ++i) {
+                if (children[i]->kind == ItemKind::DOT) {
+                    auto const &child = static_cast<DotItem<CharT> const &>(*children[i]);
+                    addChildren(first_child + i, child);
+                }
+            }
+        }
+
+        constexpr auto convertItem(BasicItem<CharT> const &item) -> item_t
+        {
+            switch (item.kind) {
+            case ItemKind::STRING: {
+                auto const &string_item = static_cast<string::StringItem<CharT> const &>(item);
+                auto const &string = string_item.getString();
+                auto offset = strings.size();
+
+                strings.append(string);
+                return { StringScanItem{ offset, string.size() }, item.flags };
+            }
+
+            case ItemKind::REGEX: {
+                auto const &regex_item = static_cast<regex::RegexItem<CharT> const &>(item);
+
+                bitmaps.push_back(regex_item.getAvailableChars());
+                return { RegexScanItem{ bitmaps.size() - 1 }, item.flags };
+            }
+
+            default:
+                return { SequenceScanItem{}, item.flags };
+            }
+        }
+
+        CERBLIB_DECL auto
+            matchItem(item_t const &item, BasicStringView<CharT> const &text, size_t position)
+                const -> size_t
+        {
+            auto can_repeat = item.flags.isAnyOfSet(ItemFlags::STAR | ItemFlags::PLUS);
+            auto can_be_skipped = item.flags.isAnyOfSet(ItemFlags::STAR | ItemFlags::QUESTION);
+            size_t repetitions = 0;
+
+            while (true) {
+                auto next_position = std::visit(
+                    [this, &text, position](auto const &value) {
+                        return matchValue(value, text, position);
+                    },
+                    item.value);
+
+                if (next_position == npos) {
+                    break;
+                }
+
+                ++repetitions;
+                std::swap(position, next_position);
+
+                if (logicalOr(not can_repeat, position == next_position)) {
+                    break;
+                }
+            }
+
+            return logicalOr(repetitions != 0, can_be_skipped) ? position : npos;
+        }
+
+        CERBLIB_DECL auto matchValue(
+            StringScanItem const &value, BasicStringView<CharT> const &text, size_t position) const
+            -> size_t
+        {
+            if (text.containsAt(position, getString(value))) {
+                return position + value.length;
+            }
+
+            return npos;
+        }
+
+        CERBLIB_DECL auto matchValue(
+            RegexScanItem const &value, BasicStringView<CharT> const &text, size_t position) const
+            -> size_t
+        {
+            if (position < text.size() && getAvailableChars(value).at(asUInt(text[position]))) {
+                return position + 1;
+            }
+
+            return npos;
+        }
+
+        CERBLIB_DECL auto matchValue(
+            SequenceScanItem const &value, BasicStringView<CharT> const &text,
+            size_t position) const -> size_t
+        {
+            for (size_t i = 0; i != value.number_of_children; ++i) {
+                position = matchItem(items[value.first_child + i], text, position);
+
+                if (position == npos) {
+                    return npos;
+                }
+            }
+
+            return position;
+        }
+
+        std::vector<item_t> items{};
+        std::basic_string<CharT> strings{};
+        std::vector<Bitmap> bitmaps{};
+        std::basic_string<CharT> nonterminal{};
+    };
+}// namespace cerb::lex
+
+#endif /* CERBERUS_SCAN_ITEM_HPP */
@@ -16,14 +16,9 @@ namespace cerb::lex::string
             return string;
         }
 
-        CERBLIB_DECL auto scan(text::GeneratorForText<CharT> /*unused*/) const
-            -> ScanResult override
-        {
-            return ScanResult{};
-        }
-
         constexpr StringItem(CERBLIB_BASIC_ITEM_ARGS, text::GeneratorForText<CharT> &generator)
-          : CERBLIB_CONSTRUCT_BASIC_ITEM, string(convertStringToCodes(cast('\"'), generator))
+          : CERBLIB_CONSTRUCT_BASIC_ITEM(ItemKind::STRING),
+            string(convertStringToCodes(cast('\"'), generator))
         {
             checkThatStringIsNotEmpty(generator);
         }
@@ -31,6 +31,30 @@ namespace cerb::lex
                                                             dot_items, analysis_globals };
         }
 
+        // scanning of the input throws OperationCancelledError once the token is cancelled or
+        // its deadline is exceeded
+        auto addSource(
+            BasicStringView<CharT> const &input, CancellationToken const &token,
+            size_t check_interval = CancellationCheckpoint::default_check_interval) -> void
+        {
+            text::GeneratorForText generator{ input };
+            generator.setCancellationToken(token, check_interval);
+
+            InputAnalyzer<CharT, CharForId> input_analyzer{ std::move(generator), dot_items,
+                                                            analysis_globals };
+        }
+
+        // errors in the input are recorded in diagnostics and scanning goes on after them
+        constexpr auto addSource(
+            BasicStringView<CharT> const &input, text::Diagnostics &diagnostics) -> void
+        {
+            text::GeneratorForText generator{ input };
+            generator.setDiagnostics(diagnostics);
+
+            InputAnalyzer<CharT, CharForId> input_analyzer{ std::move(generator), dot_items,
+                                                            analysis_globals };
+        }
+
         LexicalAnalyzer() = default;
 
         constexpr LexicalAnalyzer(std::initializer_list<InitPack> const &items)
@@ -40,6 +64,7 @@ namespace cerb::lex
             }
 
             analysis_globals.lazy_executor.join();
+            analysis_globals.item_arena.clear();
         }
 
     private:
@@ -57,19 +82,21 @@ namespace cerb::lex
             size_t id = hash::hashString(init_pack.rule_name);
 
             DotItem<CharT> new_item = { analysis_globals, id, rule };
-            emplaceNewDotItem(id, init_pack.rule_name, new_item);
+            emplaceNewRule(id, init_pack.rule_name, ScanItemTree<CharT>{ new_item });
         }
 
-        auto emplaceNewDotItem(
-            size_t id, BasicStringView<CharForId> const &rule_name, DotItem<CharT> &item) -> void
+        // parsed items are frozen into a scan tree, their parsing state is released with the arena
+        auto emplaceNewRule(
+            size_t id, BasicStringView<CharForId> const &rule_name, ScanItemTree<CharT> &&tree)
+            -> void
         {
             std::scoped_lock lock{ dot_item_mutex };
 
             if (not dot_items.contains(id)) {
-                dot_items.emplace(id, Rule<CharT>{ std::vector<DotItem<CharT>>{}, rule_name });
+                dot_items.emplace(id, rule_t{ std::vector<ScanItemTree<CharT>>{}, rule_name });
             }
 
-            dot_items[id].items.push_back(std::move(item));
+            dot_items[id].items.push_back(std::move(tree));
         }
 
         std::map<size_t, rule_t> dot_items{};
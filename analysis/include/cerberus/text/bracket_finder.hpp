@@ -26,21 +26,35 @@ namespace cerb::text
 
         constexpr BracketFinder(
             CharT opening_bracket, CharT closing_bracket, GeneratorForText<CharT> const &gen)
-          : text(gen), open_bracket(opening_bracket), close_bracket(closing_bracket)
+          : text(gen), brackets({ opening_bracket, closing_bracket }),
+            open_bracket(opening_bracket), close_bracket(closing_bracket)
         {}
 
+        // when errors are recorded in diagnostics, missing starting bracket gives 0 and unclosed
+        // bracket is treated as closed at the EoF
         CERBLIB_DECL auto findBracketPosition() -> size_t
         {
             initialize();
-            isBeginBracket();
+
+            if (not isBeginBracket()) {
+                return 0;
+            }
+
             passed_brackets = 1;
+            auto begin_offset = text.charOffset();
+
+            while (passed_brackets != 0) {
+                auto chr = nextBracket();
+
+                if (lex::isEoF(chr)) {
+                    return text.charOffset() - begin_offset;
+                }
 
-            while (canContinueSearching()) {
-                CharT chr = getChar();
                 processChar(chr);
             }
 
-            return text.charOffset() - 1;
+            nextChar();
+            return text.charOffset() - 1 - begin_offset;
         }
 
     private:
@@ -70,29 +84,37 @@ namespace cerb::text
             return text.getRawChar();
         }
 
-        CERBLIB_DECL auto canContinueSearching() -> bool
+        // chars between brackets are skipped with vectorized search
+        constexpr auto nextBracket() -> CharT
         {
-            if (isCurrentCharEoF()) {
-                throw BracketFinderError("Unexpected EoF!");
+            CharT chr = text.skipToAnyOf({ brackets.data(), brackets.size() });
+
+            if (lex::isEoF(chr)) {
+                reportError("Unexpected EoF!");
             }
 
-            nextChar();
-            return passed_brackets != 0;
+            return chr;
         }
 
-        CERBLIB_DECL auto isCurrentCharEoF() const -> bool
+        constexpr auto isBeginBracket() const -> bool
         {
-            return lex::isEoF(getChar());
+            if (getChar() != open_bracket) {
+                reportError("Unable to find starting bracket!");
+                return false;
+            }
+
+            return true;
         }
 
-        constexpr auto isBeginBracket() const -> void
+        constexpr auto reportError(string_view const &message) const -> void
         {
-            if (getChar() != open_bracket) {
-                throw BracketFinderError("Unable to find starting bracket!");
+            if (not text.recordError(message)) {
+                throw BracketFinderError(message.strView());
             }
         }
 
         GeneratorForText<CharT> text{};
+        std::array<CharT, 2> brackets{};
         size_t passed_brackets{};
         CharT open_bracket{};
         CharT close_bracket{};
@@ -0,0 +1,60 @@
+#ifndef CERBERUS_BRACKET_TABLE_HPP
+#define CERBERUS_BRACKET_TABLE_HPP
+
+#include <cerberus/memory.hpp>
+#include <cerberus/string_view.hpp>
+#include <array>
+#include <vector>
+
+namespace cerb::text
+{
+    // Matching brackets of the whole text, which are found in a single pass. Brackets are found
+    // with vectorized search and matched with a stack of opening brackets, so nested groups are
+    // not rescanned. Brackets are matched the same way as in BracketFinder.
+    template<CharacterLiteral CharT>
+    class BracketTable
+    {
+    public:
+        constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+        // offset of the closing bracket for the opening bracket at the given offset or npos
+        CERBLIB_DECL auto findClosingBracket(size_t offset) const -> size_t
+        {
+            return offset < closing_brackets.size() ? closing_brackets[offset] : npos;
+        }
+
+        BracketTable() = default;
+
+        constexpr BracketTable(
+            BasicStringView<CharT> const &text, CharT opening_bracket, CharT closing_bracket)
+          : closing_brackets(text.size(), npos)
+        {
+            std::array<CharT, 2> brackets = { opening_bracket, closing_bracket };
+            std::vector<size_t> opened_brackets{};
+
+            auto const *end = text.end();
+
+            for (auto const *it = text.begin(); it != end; ++it) {
+                it = cerb::findAnyOf(it, ptrdiff(it, end), brackets.data(), brackets.size());
+
+                if (it == end) {
+                    break;
+                }
+
+                auto offset = ptrdiff(text.begin(), it);
+
+                if (*it == opening_bracket) {
+                    opened_brackets.push_back(offset);
+                } else if (not opened_brackets.empty()) {
+                    closing_brackets[opened_brackets.back()] = offset;
+                    opened_brackets.pop_back();
+                }
+            }
+        }
+
+    private:
+        std::vector<size_t> closing_brackets{};
+    };
+}// namespace cerb::text
+
+#endif /* CERBERUS_BRACKET_TABLE_HPP */
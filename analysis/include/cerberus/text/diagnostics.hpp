@@ -0,0 +1,56 @@
+#ifndef CERBERUS_DIAGNOSTICS_HPP
+#define CERBERUS_DIAGNOSTICS_HPP
+
+#include <cerberus/string_view.hpp>
+#include <vector>
+
+namespace cerb::text
+{
+    // message is a string literal, so diagnostic does not own any memory
+    struct Diagnostic
+    {
+        string_view message{};
+        size_t offset{};
+        size_t line{};
+        size_t char_position{};
+    };
+
+    // Sink for errors of text scanners. Scanners with a sink record their errors and
+    // resynchronize instead of throwing. Only the first error at each offset is kept, because the
+    // following ones are caused by it.
+    class Diagnostics
+    {
+    public:
+        CERBLIB_DECL auto getDiagnostics() const -> std::vector<Diagnostic> const &
+        {
+            return diagnostics;
+        }
+
+        CERBLIB_DECL auto size() const -> size_t
+        {
+            return diagnostics.size();
+        }
+
+        CERBLIB_DECL auto empty() const -> bool
+        {
+            return diagnostics.empty();
+        }
+
+        constexpr auto add(Diagnostic const &diagnostic) -> void
+        {
+            if (empty() || diagnostics.back().offset != diagnostic.offset) {
+                diagnostics.push_back(diagnostic);
+            }
+        }
+
+        constexpr auto clear() -> void
+        {
+            diagnostics.clear();
+        }
+
+    private:
+        std::vector<Diagnostic> diagnostics{};
+    };
+}// namespace cerb::text
+
+#endif /* CERBERUS_DIAGNOSTICS_HPP */
@@ -1,8 +1,9 @@
 #ifndef CERBERUS_TEXT_GENERATOR_HPP
 #define CERBERUS_TEXT_GENERATOR_HPP
 
+#include <cerberus/cancellation.hpp>
 #include <cerberus/lex/char.hpp>
-#include <cerberus/text/generator_modules/tabs_and_spaces_saver.hpp>
+#include <cerberus/text/diagnostics.hpp>
 #include <cerberus/text/location_in_file.hpp>
 #include <cerberus/text/scan_api_modules/skip_mode.hpp>
 #include <cerberus/text/text_exception.hpp>
@@ -17,7 +18,6 @@ namespace cerb::text
     {
         using char_enum = lex::CharEnum<CharT>;
         using iterator = GetIteratorType<BasicStringView<CharT>>;
-        using tabs_and_spaces_saver_t = gen::TabsAndSpacesSaver<CharT>;
 
         CERBLIB_DECL auto currentBegin() const -> iterator
         {
@@ -37,9 +37,23 @@ namespace cerb::text
             return initialized;
         }
 
-        CERBLIB_DECL auto getTabsAndSpaces() const -> std::basic_string<CharT> const &
+        // tabs and spaces before the current char in its line, including the current char
+        CERBLIB_DECL auto getTabsAndSpaces() const -> BasicStringView<CharT>
         {
-            return tabs_and_spaces.get();
+            auto chr = getCurrentChar();
+
+            if (logicalOr(not initialized, chr == char_enum::NewLine)) {
+                return {};
+            }
+
+            auto run_end = min(charOffset() + (isTabOrSpace(chr) ? 1 : 0), text.size());
+            auto run_begin = run_end;
+
+            while (run_begin != 0 && isTabOrSpace(at(run_begin - 1))) {
+                --run_begin;
+            }
+
+            return { text.begin() + run_begin, run_end - run_begin };
         }
 
         CERBLIB_DECL auto getText() const -> BasicStringView<CharT> const &
@@ -73,6 +87,8 @@ namespace cerb::text
                 return char_enum::EoF;
             }
 
+            cancellation_checkpoint.tick();
+
             if (not initialized) {
                 processFirstRawChar();
             } else {
@@ -91,9 +107,65 @@ namespace cerb::text
             return getCurrentChar();
         }
 
+        // moves to the next char, which is one of the needles, or to the EoF
+        constexpr auto skipToAnyOf(BasicStringView<CharT> const &needles) -> CharT
+        {
+            return skipTo([&needles](CharT const *location, size_t limit) {
+                return cerb::findAnyOf(location, limit, needles.begin(), needles.size());
+            });
+        }
+
+        // moves to the next char, which belongs to the class, or to the EoF
+        constexpr auto skipToClass(CharClass const &char_class) -> CharT
+        {
+            return skipTo([&char_class](CharT const *location, size_t limit) {
+                return cerb::findClass(location, limit, char_class);
+            });
+        }
+
+        // token is checked once per check_interval characters and must outlive the generator
+        // and all of its forks
+        auto setCancellationToken(
+            CancellationToken const &token,
+            size_t check_interval = CancellationCheckpoint::default_check_interval) -> void
+        {
+            cancellation_checkpoint = CancellationCheckpoint{ token, check_interval };
+        }
+
+        // errors of scanners are recorded in the sink instead of being thrown, sink must outlive
+        // the generator and all of its forks
+        constexpr auto setDiagnostics(Diagnostics &diagnostics_sink) -> void
+        {
+            diagnostics = &diagnostics_sink;
+        }
+
+        CERBLIB_DECL auto isRecoveringFromErrors() const -> bool
+        {
+            return diagnostics != nullptr;
+        }
+
+        // records the error at the current char, returns false when there is no sink, so the
+        // caller has to throw
+        constexpr auto recordError(string_view const &message) const -> bool
+        {
+            if (diagnostics == nullptr) {
+                return false;
+            }
+
+            diagnostics->add({ message, charOffset(), line(), charPosition() });
+            return true;
+        }
+
         template<SkipMode Mode = RAW_CHARS>
         constexpr auto skip(size_t times) -> void
         {
+            if constexpr (Mode == RAW_CHARS) {
+                if (logicalAnd(initialized, times > 1)) {
+                    skipRawChars(times);
+                    return;
+                }
+            }
+
             for (size_t i = 0; i != times; ++i) {
                 if constexpr (Mode == CLEAN_CHARS) {
                     getCleanChar();
@@ -103,6 +175,9 @@ namespace cerb::text
             }
         }
 
+        // Forked generator is a copy of this one, which is moved by from chars and ends before
+        // the char at offset to. Generator state is trivially copyable, so a raw fork is a struct
+        // copy and a jump to the target offset.
         template<SkipMode Mode = RAW_CHARS>
         CERBLIB_DECL auto fork(size_t from, size_t to) const -> GeneratorForText<CharT>
         {
@@ -111,12 +186,22 @@ namespace cerb::text
             GeneratorForText<CharT> forked_generator = *this;
             BasicStringView<CharT> &forked_text = forked_generator.text;
 
-            forked_generator.template skip<Mode>(from);
+            if constexpr (Mode == CLEAN_CHARS) {
+                forked_generator.template skip<Mode>(from);
+            } else if (from != 0) {
+                auto chars_to_move = from;
+
+                // the first raw char initializes generator without moving it, as skip does
+                if (not initialized) {
+                    forked_generator.getRawChar();
+                    --chars_to_move;
+                }
+
+                forked_generator.moveTo(charOffset() + chars_to_move);
+            }
 
-            auto forked_text_begin = forked_text.begin();
-            auto forked_text_length = to - from;
+            forked_text = { forked_text.begin(), charOffset() + to };
 
-            forked_text = { forked_text_begin, forked_text_length };
             return forked_generator;
         }
 
@@ -136,10 +221,99 @@ namespace cerb::text
             return text[index];
         }
 
+        // same as calling getRawChar() the given number of times
+        constexpr auto skipRawChars(size_t times) -> void
+        {
+            auto offset = charOffset();
+
+            if (logicalOr(offset >= text.size(), isCurrentCharEoF())) {
+                return;
+            }
+
+            auto const *next_char = text.begin() + offset + 1;
+            auto search_length = min(times, text.size() - offset - 1);
+            auto const *eof = cerb::find(next_char, char_enum::EoF, search_length);
+
+            if (eof != next_char + search_length) {
+                moveTo(offset + 1 + ptrdiff(next_char, eof));
+            } else {
+                moveTo(min(offset + times, text.size()));
+            }
+        }
+
+        template<typename Finder>
+        constexpr auto skipTo(Finder &&finder) -> CharT
+        {
+            if (not initialized) {
+                CharT chr = getRawChar();
+
+                if (logicalOr(lex::isEoF(chr), finder(&chr, 1) == &chr)) {
+                    return chr;
+                }
+            }
+
+            auto offset = charOffset();
+
+            if (logicalOr(isCurrentCharEoF(), offset >= text.size())) {
+                return getRawChar();
+            }
+
+            auto const *next_char = text.begin() + offset + 1;
+            auto rest_length = text.size() - offset - 1;
+            auto length_before_eof =
+                ptrdiff(next_char, cerb::find(next_char, char_enum::EoF, rest_length));
+
+            moveTo(offset + 1 + ptrdiff(next_char, finder(next_char, length_before_eof)));
+            return getCurrentChar();
+        }
+
+        // same as calling getRawChar until target offset is reached
+        constexpr auto moveTo(size_t target) -> void
+        {
+            auto offset = charOffset();
+            auto const *passed_begin = text.begin() + offset + 1;
+            auto const *passed_end = text.begin() + min(target + 1, text.size());
+
+            cancellation_checkpoint.tick(target - offset);
+
+            auto passed_lines =
+                static_cast<size_t>(std::count(passed_begin, passed_end, char_enum::NewLine));
+            auto chars_after_last_line = target - offset;
+
+            if (passed_lines != 0) {
+                auto last_line = std::find(
+                    std::make_reverse_iterator(passed_end),
+                    std::make_reverse_iterator(passed_begin), char_enum::NewLine);
+                chars_after_last_line = ptrdiff(last_line.base(), text.begin() + target) + 1;
+            }
+
+            location_t::newChars(target - offset, passed_lines, chars_after_last_line);
+
+            updateLineAfterMove(offset, target);
+        }
+
+        constexpr auto updateLineAfterMove(size_t previous_offset, size_t target) -> void
+        {
+            auto const *search_begin = text.begin() + previous_offset;
+            auto const *search_end = text.begin() + min(target, text.size());
+
+            auto last_line = std::find(
+                std::make_reverse_iterator(search_end), std::make_reverse_iterator(search_begin),
+                char_enum::NewLine);
+
+            if (last_line.base() != search_begin) {
+                updateCurrentLine(ptrdiff(text.begin(), last_line.base()));
+            }
+        }
+
+        CERBLIB_DECL static auto isTabOrSpace(CharT chr) -> bool
+        {
+            return logicalOr(chr == char_enum::Tab, chr == char_enum::Space);
+        }
+
         constexpr auto processFirstRawChar() -> void
         {
             initialized = true;
-            tryToAddTabOrSpace();
         }
 
         constexpr auto processRawChar() -> void
@@ -163,11 +337,15 @@ namespace cerb::text
 
         constexpr auto updateCurrentLine() -> void
         {
-            auto offset = location_t::charOffset();
+            updateCurrentLine(location_t::charOffset());
+        }
+
+        constexpr auto updateCurrentLine(size_t offset) -> void
+        {
             size_t line_end = text.find(char_enum::NewLine, offset);
             size_t line_length = line_end - offset;
 
-            current_line = { currentBegin(), line_length };
+            current_line = { text.begin() + offset, line_length };
         }
 
         constexpr auto updateLocationToTheNextChar() -> void
@@ -175,35 +353,12 @@ namespace cerb::text
             auto future_offset = location_t::charOffset() + 1;
 
             if (at(future_offset) == char_enum::NewLine) {
-                processNewLine();
+                location_t::newLine();
             } else {
-                processNewChar();
+                location_t::newChar();
             }
         }
 
-        constexpr auto processNewLine() -> void
-        {
-            location_t::newLine();
-            tabs_and_spaces.clear();
-        }
-
-        constexpr auto processNewChar() -> void
-        {
-            tryToClearTabsAndSpaces();
-            location_t::newChar();
-            tryToAddTabOrSpace();
-        }
-
-        constexpr auto tryToClearTabsAndSpaces() -> void
-        {
-            tabs_and_spaces.tryToClear(getCurrentChar());
-        }
-
-        constexpr auto tryToAddTabOrSpace() -> void
-        {
-            tabs_and_spaces.tryToAdd(getCurrentChar());
-        }
-
         CERBLIB_DECL auto calculateRealOffset(ssize_t offset) const -> size_t
         {
             auto real_offset = static_cast<ssize_t>(charOffset()) + offset;
@@ -234,7 +389,8 @@ namespace cerb::text
             }
         }
 
-        tabs_and_spaces_saver_t tabs_and_spaces{};
+        CancellationCheckpoint cancellation_checkpoint{};
+        Diagnostics *diagnostics{ nullptr };
         BasicStringView<CharT> text{};
         BasicStringView<CharT> current_line{};
         bool initialized{ false };
@@ -53,6 +53,20 @@ namespace cerb::text
             char_number = 0;
         }
 
+        // same as calling newChar or newLine for each of the passed chars
+        constexpr auto newChars(
+            size_t passed_chars, size_t passed_lines, size_t chars_after_last_line) -> void
+        {
+            char_offset += passed_chars;
+
+            if (passed_lines == 0) {
+                char_number += passed_chars;
+            } else {
+                line_number += passed_lines;
+                char_number = chars_after_last_line;
+            }
+        }
+
         LocationInFile() = default;
 
         constexpr explicit LocationInFile(
@@ -21,7 +21,7 @@
 namespace cerb::text
 {
     // NOLINTNEXTLINE
-    CERBERUS_ENUM(ScanApiStatus, u8, SKIP_CHAR = 1, DO_NOT_SKIP_CHAR = 0);
+    CERBERUS_ENUM(ScanApiStatus, u8, SKIP_CHAR = 1, DO_NOT_SKIP_CHAR = 0, STOP_SCANNING = 2);
 
     CERBERUS_EXCEPTION(BasicScanApiError, BasicTextAnalysisException);
 
@@ -77,7 +77,7 @@ namespace cerb::text
             auto chr = nextChar();
 
             if (lex::isEoF(chr)) {
-                throwException("Unexpected EoF!");
+                reportError("Unexpected EoF!");
             }
 
             return chr;
@@ -89,7 +89,8 @@ namespace cerb::text
             CharT chr = getChar();
 
             if (logicalAnd(lex::isEoF(chr), end_symbol != CharEnum<CharT>::EoF)) {
-                throwException("Unable to continue, because of unexpected EoF!");
+                reportError("Unable to continue, because of unexpected EoF!");
+                return false;
             }
 
             return chr != end_symbol;
@@ -117,7 +118,13 @@ namespace cerb::text
         {
             setupGenerator();
 
-            if (onStart() == ScanApiStatus::SKIP_CHAR) {
+            auto status = onStart();
+
+            if (status == ScanApiStatus::STOP_SCANNING) {
+                return;
+            }
+
+            if (status == ScanApiStatus::SKIP_CHAR) {
                 nextChar();
             }
 
@@ -172,9 +179,12 @@ namespace cerb::text
             return text_generator.getCurrentChar(i + 1);
         }
 
-        constexpr auto throwException(string_view const &message) const -> void
+        // throws ScanApiError, unless the generator records errors in diagnostics
+        constexpr auto reportError(string_view const &message) const -> void
         {
-            throw ScanApiError(message, text_generator);
+            if (not text_generator.recordError(message)) {
+                throw ScanApiError(message, text_generator);
+            }
         }
 
         GeneratorForText<CharT> &text_generator;
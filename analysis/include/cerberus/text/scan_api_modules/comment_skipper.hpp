@@ -2,6 +2,7 @@
 #define CERBERUS_COMMENT_SKIPPER_HPP
 
 #include <cerberus/analysis/analysis_exception.hpp>
+#include <cerberus/searcher.hpp>
 #include <cerberus/text/generator_for_text.hpp>
 #include <cerberus/text/scan_api_modules/skip_mode.hpp>
 
@@ -37,7 +38,8 @@ namespace cerb::text
             BasicStringView<CharT> const &multiline_comment_begin = {},
             BasicStringView<CharT> const &multiline_comment_end = {})
           : single_line(single_line_comment), multiline_begin(multiline_comment_begin),
-            multiline_end(multiline_comment_end), text_generator(generator_for_text)
+            multiline_end(multiline_comment_end), multiline_end_searcher(multiline_comment_end),
+            text_generator(generator_for_text)
         {}
 
     private:
@@ -55,24 +57,31 @@ namespace cerb::text
         {
             text_generator.skip(single_line.size());
 
-            while (isNewLineOrEoF(text_generator.getRawChar())) {
-                // empty loop
+            if (not isNewLineOrEoF(text_generator.getCurrentChar())) {
+                text_generator.skipToClass(new_line_class);
             }
         }
 
         constexpr auto skipMultiline(BasicStringView<CharT> const &text) -> void
         {
-            size_t offset = multiline_begin.size();
-            GeneratorForText<CharT> comment_begin = text_generator;
+            auto end_position = multiline_end_searcher.find(text, multiline_begin.size());
 
-            text_generator.skip(offset);
+            if (end_position == BasicStringView<CharT>::npos) {
+                reportUnterminatedComment();
 
-            while (not text.containsAt(offset, multiline_end)) {
-                ++offset;
+                // comment takes the rest of the text
+                text_generator.skip(text.size());
+                return;
             }
 
-            if (not text.containsAt(offset, multiline_end)) {
-                throw CommentSkipperException<CharT>("Unterminated comment.", comment_begin);
+            // generator stops at the last char of the comment terminator
+            text_generator.skip(end_position + multiline_end.size() - 1);
+        }
+
+        constexpr auto reportUnterminatedComment() const -> void
+        {
+            if (not text_generator.recordError("Unterminated comment.")) {
+                throw CommentSkipperException<CharT>("Unterminated comment.", text_generator);
             }
         }
 
@@ -81,9 +90,12 @@ namespace cerb::text
             return logicalOr(chr == char_enum::NewLine, chr == char_enum::EoF);
         }
 
+        constexpr static CharClass new_line_class{ std::array{ char_enum::NewLine } };
+
         BasicStringView<CharT> single_line{};
         BasicStringView<CharT> multiline_begin{};
         BasicStringView<CharT> multiline_end{};
+        Searcher<CharT> multiline_end_searcher{};
         GeneratorForText<CharT> &text_generator;
     };
 }// namespace cerb::text
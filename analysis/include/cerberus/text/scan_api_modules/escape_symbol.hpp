@@ -1,6 +1,7 @@
 #ifndef CERBERUS_ESCAPE_SYMBOL_HPP
 #define CERBERUS_ESCAPE_SYMBOL_HPP
 
+#include <cerberus/flat_map.hpp>
 #include <cerberus/text/scan_api_modules/notation_escape_symbol.hpp>
 #include <cerberus/text/scan_api_modules/skip_mode.hpp>
 
@@ -11,6 +12,7 @@ namespace cerb::text
     {
         using symbol_pair = Pair<CharT, CharT, PairComparison::BY_FIRST_VALUE>;
         using scan_api_t = ScanApi<Mode, CharT>;
+        using notation_escape_map_t = SortedFlatMap<CharT, Pair<u32, u32>, 3>;
 
         template<std::integral Int>
         CERBLIB_DECL static auto cast(Int value) -> CharT
@@ -21,45 +23,18 @@ namespace cerb::text
         constexpr auto parseEscapeSequence() -> CharT
         {
             CharT chr = scan_api.getNextCharAndCheckForEoF();
-            constexpr size_t octal_notation = 8;
-            constexpr size_t hexadecimal_notation = 16;
+            auto simple_escape = simple_escape_symbols[chr];
 
-            switch (chr) {
-            case cast('\\'):
-                return cast('\\');
-
-            case cast('\''):
-                return cast('\'');
-
-            case cast('\"'):
-                return cast('\"');
-
-            case cast('t'):
-                return cast('\t');
-
-            case cast('n'):
-                return cast('\n');
-
-            case cast('r'):
-                return cast('\r');
-
-            case cast('f'):
-                return cast('\f');
-
-            case cast('b'):
-                return cast('\b');
-
-            case cast('0'):
-                return convertCharEscape<octal_notation>(scan_api, 2);
-
-            case cast('x'):
-                return convertCharEscape<hexadecimal_notation>(scan_api, 2);
+            if (simple_escape != lex::CharEnum<CharT>::EoF) {
+                return simple_escape;
+            }
 
-            case cast('u'):
-                return convertCharEscape<hexadecimal_notation>(scan_api, 4);
+            auto notation_escape = notation_escape_symbols.find(chr);
 
-            default:
-                break;
+            if (notation_escape != notation_escape_map_t::npos) {
+                auto [notation, length] = notation_escape_symbols.getValues()[notation_escape];
+                NotationEscapeSymbol char_escape{ scan_api, notation, length };
+                return char_escape.convert();
             }
 
             return searchForSpecialUserSymbol(chr);
@@ -78,12 +53,25 @@ namespace cerb::text
             auto location = std::find(special_symbols.begin(), special_symbols.end(), chr);
 
             if (location == special_symbols.end()) {
-                scan_api.throwException("Unable to match any escape sequence!");
+                scan_api.reportError("Unable to match any escape sequence!");
+                return chr;
             }
 
             return location->second;
         }
 
+        // escape sequences, which are replaced with a single char
+        static constexpr auto simple_escape_symbols = CharTable<CharT, CharT>{
+            { cast('\\'), cast('\\') }, { cast('\''), cast('\'') }, { cast('\"'), cast('\"') },
+            { cast('t'), cast('\t') },   { cast('n'), cast('\n') },   { cast('r'), cast('\r') },
+            { cast('f'), cast('\f') },   { cast('b'), cast('\b') }
+        };
+
+        // escape sequences with a number: notation and maximum number of digits
+        static constexpr auto notation_escape_symbols = notation_escape_map_t{
+            { cast('0'), { 8, 2 } }, { cast('x'), { 16, 2 } }, { cast('u'), { 16, 4 } }
+        };
+
         scan_api_t &scan_api;
         std::initializer_list<symbol_pair> const &special_symbols;
     };
@@ -49,12 +49,7 @@ namespace cerb::text
 
         CERBLIB_DECL static auto isOutOfNotation(CharT chr, u32 notation) -> bool
         {
-            if (not hexadecimal_chars.contains(chr)) {
-                return true;
-            }
-
-            auto code = convertSymbolToInt(chr);
-            return static_cast<i32>(code) >= static_cast<i32>(notation);
+            return hexadecimal_chars[chr] >= notation;
         }
 
         CERBLIB_DECL static auto convertSymbolToInt(CharT chr) -> CharT
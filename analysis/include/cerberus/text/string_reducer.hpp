@@ -1,11 +1,13 @@
 #ifndef CERBERUS_STRING_REDUCER_HPP
 #define CERBERUS_STRING_REDUCER_HPP
 
-#include <cerberus/text/generator_for_text.hpp>
-#include <string>
+#include <cerberus/lex/char.hpp>
+#include <cerberus/string_view.hpp>
 
 namespace cerb::text
 {
+    // Cuts the line around the error position to about 20 chars on each side. Borders are moved
+    // further until a layout char, so words are not cut in the middle.
     template<CharacterLiteral CharT>
     struct StringReducer
     {
@@ -21,8 +23,9 @@ namespace cerb::text
 
         StringReducer() = default;
 
-        constexpr explicit StringReducer(GeneratorForText<CharT> const &generator)
-          : text_generator(generator), base_index(generator.charOffset() - 1)
+        constexpr StringReducer(BasicStringView<CharT> const &text_line, size_t error_position)
+          : line(text_line), base_index(min(error_position, text_line.size())),
+            left_border(base_index), right_border(base_index)
         {
             reduceString();
         }
@@ -52,33 +55,37 @@ namespace cerb::text
         CERBLIB_DECL auto leftBorderReducingNeeded() const -> bool
         {
             constexpr size_t left_border_max_length = 20;
-            size_t left_border_length = base_index - left_border;
 
-            bool is_not_end_of_string = left_border > 0;
-            bool in_border = left_border_length < left_border_max_length;
-            bool is_not_layout_char = not lex::isLayout(line[left_border]);
+            if (left_border == 0) {
+                return false;
+            }
 
-            return (in_border || is_not_layout_char) && is_not_end_of_string;
+            bool in_border = base_index - left_border < left_border_max_length;
+            return in_border || isNotLayoutAt(left_border);
         }
 
         CERBLIB_DECL auto rightBorderReducingNeeded() const -> bool
         {
             constexpr size_t right_border_max_length = 20;
-            size_t right_border_length = right_border - base_index;
 
-            bool is_not_end_of_string = right_border < line.size();
-            bool in_border = right_border_length < right_border_max_length;
-            bool is_not_layout_char = not lex::isLayout(line[right_border]);
+            if (right_border >= line.size()) {
+                return false;
+            }
 
-            return (in_border || is_not_layout_char) && is_not_end_of_string;
+            bool in_border = right_border - base_index < right_border_max_length;
+            return in_border || isNotLayoutAt(right_border);
+        }
+
+        CERBLIB_DECL auto isNotLayoutAt(size_t index) const -> bool
+        {
+            return index < line.size() && not lex::isLayout(line[index]);
         }
 
         BasicStringView<CharT> reduced_string{};
-        GeneratorForText<CharT> const &text_generator;
-        BasicStringView<CharT> const &line{ text_generator.getCurrentLine() };
+        BasicStringView<CharT> line{};
         size_t base_index{};
-        size_t left_border{ base_index };
-        size_t right_border{ base_index };
+        size_t left_border{};
+        size_t right_border{};
     };
 }// namespace cerb::text
 
@@ -32,24 +32,53 @@ namespace cerb::text
     private:
         constexpr auto onStart() -> text::ScanApiStatus override
         {
-            checkStringStart();
+            if (not isBeginOfString(getChar())) {
+                reportStringStartError();
+                return text::ScanApiStatus::STOP_SCANNING;
+            }
+
             return text::ScanApiStatus::SKIP_CHAR;
         }
 
         constexpr auto processChar(CharT chr) -> void override
         {
-            if (chr == lex::CharEnum<CharT>::Backlash) {
-                parsed_string.push_back(
-                    parseEscapeSequence({ { string_begin_char, string_begin_char } }));
-            } else {
-                parsed_string.push_back(chr);
+            if (chr != lex::CharEnum<CharT>::Backlash) {
+                appendCharsRun();
+                return;
+            }
+
+            auto escaped_char = parseEscapeSequence({ { string_begin_char, string_begin_char } });
+
+            // escape sequence is cut by the EoF, when errors are recorded instead of thrown
+            if (not lex::isEoF(getChar())) {
+                parsed_string.push_back(escaped_char);
             }
         }
 
-        constexpr auto checkStringStart() const -> void
+        // chars up to the next backslash, end of the string or EoF are copied at once and the
+        // generator is moved to the last of them
+        constexpr auto appendCharsRun() -> void
         {
-            if (not isBeginOfString(getChar())) {
-                throw StringToCodesTranslationError("Unable to open string!", getGenerator());
+            using char_enum = lex::CharEnum<CharT>;
+
+            auto rest = getGenerator().getRestOfTheText();
+            std::array<CharT, 3> run_terminators = { char_enum::Backlash, string_begin_char,
+                                                     char_enum::EoF };
+
+            auto const *run_end = cerb::findAnyOf(
+                rest.begin() + 1, rest.size() - 1, run_terminators.data(), run_terminators.size());
+            auto run_length = ptrdiff(rest.begin(), run_end);
+
+            parsed_string.append(rest.begin(), run_length);
+            scan_api_t::skip(run_length - 1);
+        }
+
+        constexpr auto reportStringStartError() const -> void
+        {
+            auto const &generator = getGenerator();
+
+            if (not generator.recordError("Unable to open string!")) {
+                throw StringToCodesTranslationError("Unable to open string!", generator);
             }
         }
 
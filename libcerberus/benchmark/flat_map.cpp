@@ -0,0 +1,93 @@
+#include <cerberus/debug/benchmark.hpp>
+#include <cerberus/flat_map.hpp>
+#include <fmt/format.h>
+#include <map>
+#include <random>
+#include <unordered_map>
+
+// Compares lookups of random present keys in maps of u32. Build it in Release mode without
+// sanitizers: cmake -B build -DCMAKE_BUILD_TYPE=Release -DUSE_SANITIZERS=OFF
+// -DCERBERUS_BENCHMARKS=ON
+
+namespace cerb::debug
+{
+    constexpr size_t LookupsPerCall = 256;
+
+    auto createRandomKeys(size_t size) -> std::vector<u32>
+    {
+        static std::mt19937 engine{ 0 };
+        std::vector<u32> result(size);
+
+        std::ranges::generate(result, [] { return static_cast<u32>(engine()); });
+        return result;
+    }
+
+    template<typename Map>
+    auto measureLookups(Map const &map, std::vector<u32> const &lookups) -> double
+    {
+        auto lookup_all = [&map, &lookups]() {
+            size_t found = 0;
+
+            for (u32 key : lookups) {
+                found += map.count(key);
+            }
+
+            doNotOptimize(found);
+        };
+
+        return measure(lookup_all) / static_cast<double>(lookups.size());
+    }
+
+    template<size_t Size>
+    auto benchmarkLookups() -> void
+    {
+        auto keys = createRandomKeys(Size);
+        auto lookups = std::vector<u32>(LookupsPerCall);
+
+        SortedFlatMap<u32, u32, Size> sorted_flat_map{};
+        FlatMap<u32, u32, Size> flat_map{};
+        std::map<u32, u32> map{};
+        std::unordered_map<u32, u32> unordered_map{};
+
+        for (u32 key : keys) {
+            if (not sorted_flat_map.contains(key)) {
+                sorted_flat_map.emplace(key, key);
+                flat_map.emplace(key, key);
+                map.emplace(key, key);
+                unordered_map.emplace(key, key);
+            }
+        }
+
+        auto lookup_indexes = createRandomKeys(LookupsPerCall);
+
+        for (size_t i = 0; i != LookupsPerCall; ++i) {
+            lookups[i] = keys[lookup_indexes[i] % Size];
+        }
+
+        fmt::print(
+            "{:>8}{:>16.2f}{:>16.2f}{:>16.2f}{:>16.2f}\n", Size,
+            measureLookups(sorted_flat_map, lookups), measureLookups(flat_map, lookups),
+            measureLookups(map, lookups), measureLookups(unordered_map, lookups));
+    }
+}// namespace cerb::debug
+
+auto main() -> int
+{
+    using namespace cerb::debug;
+
+    fmt::print(
+        "{:>8}{:>16}{:>16}{:>16}{:>16}\n", "size", "SortedFlatMap", "FlatMap", "std::map",
+        "unordered_map");
+    fmt::print("{:>8}{:>16}{:>16}{:>16}{:>16}\n", "", "ns", "ns", "ns", "ns");
+
+    benchmarkLookups<4>();
+    benchmarkLookups<8>();
+    benchmarkLookups<16>();
+    benchmarkLookups<32>();
+    benchmarkLookups<64>();
+    benchmarkLookups<128>();
+    benchmarkLookups<256>();
+    benchmarkLookups<512>();
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <array>
+#include <cerberus/debug/benchmark.hpp>
+#include <cerberus/memory.hpp>
+#include <cstring>
+#include <fmt/format.h>
+#include <vector>
+
+// Compares simd kernels of cerberus with the standard library. Build it in Release mode without
+// sanitizers: cmake -B build -DCMAKE_BUILD_TYPE=Release -DUSE_SANITIZERS=OFF
+// -DCERBERUS_BENCHMARKS=ON
+
+#if CERBLIB_SIMD
+namespace cerb::benchmark
+{
+    using debug::doNotOptimize;
+    using debug::measure;
+
+    constexpr size_t MiB = 1024 * 1024;
+    constexpr std::array<size_t, 8> Sizes = { 64,      4096,     256 * 1024, 4 * MiB,
+                                              8 * MiB, 16 * MiB, 32 * MiB,   64 * MiB };
+
+    template<typename Kernel, typename Reference>
+    auto report(std::string_view name, size_t size, Kernel &&kernel, Reference &&reference)
+        -> void
+    {
+        auto kernel_time = measure(kernel);
+        auto reference_time = measure(reference);
+
+        fmt::print(
+            "{:<8}{:>12}{:>16.1f}{:>16.1f}{:>10.2f}\n", name, size, kernel_time, reference_time,
+            reference_time / kernel_time);
+    }
+
+    template<typename Kernels>
+    auto benchmarkKernels(std::string_view level_name) -> void
+    {
+        fmt::print("{} kernels\n", level_name);
+        fmt::print(
+            "{:<8}{:>12}{:>16}{:>16}{:>10}\n", "", "bytes", "kernel, ns", "std, ns", "speedup");
+
+        for (size_t size : Sizes) {
+            std::vector<char> source(size, 'a');
+            std::vector<char> dest(size, 'a');
+
+            report(
+                "fill", size, [&]() { Kernels::fill(dest.data(), 'b', size); },
+                [&]() { std::fill(dest.data(), dest.data() + size, 'b'); });
+
+            report(
+                "copy", size, [&]() { Kernels::copy(dest.data(), source.data(), size); },
+                [&]() { std::copy(source.data(), source.data() + size, dest.data()); });
+
+            report(
+                "find", size, [&]() { doNotOptimize(Kernels::find(source.data(), 'b', size)); },
+                [&]() { doNotOptimize(std::memchr(source.data(), 'b', size)); });
+
+            source.back() = 'b';
+
+            report(
+                "search", size,
+                [&]() { doNotOptimize(Kernels::search(source.data(), size, "ab", 2)); },
+                [&]() {
+                    doNotOptimize(std::search(
+                        source.data(), source.data() + size, std::begin("ab"),
+                        std::begin("ab") + 2));
+                });
+        }
+
+        fmt::print("\n");
+    }
+
+#    define CERBERUS_BENCHMARK_KERNELS(LEVEL)                                                      \
+        struct LEVEL##Kernels                                                                      \
+        {                                                                                          \
+            static auto fill(char *dest, char value, size_t times) -> void                        \
+            {                                                                                      \
+                amd64::LEVEL::fill(dest, value, times);                                            \
+            }                                                                                      \
+                                                                                                   \
+            static auto copy(char *dest, char const *src, size_t bytes) -> void                   \
+            {                                                                                      \
+                amd64::LEVEL::copy(dest, src, bytes);                                              \
+            }                                                                                      \
+                                                                                                   \
+            static auto find(char const *location, char value, size_t limit) -> char const *      \
+            {                                                                                      \
+                return amd64::LEVEL::find(location, value, limit);                                 \
+            }                                                                                      \
+                                                                                                   \
+            static auto search(                                                                    \
+                char const *location, size_t limit, char const *needle, size_t needle_length)     \
+                -> char const *                                                                    \
+            {                                                                                      \
+                return amd64::LEVEL::search(location, limit, needle, needle_length);               \
+            }                                                                                      \
+        }
+
+    CERBERUS_BENCHMARK_KERNELS(sse2);
+    CERBERUS_BENCHMARK_KERNELS(avx2);
+    CERBERUS_BENCHMARK_KERNELS(avx512);
+
+#    undef CERBERUS_BENCHMARK_KERNELS
+}// namespace cerb::benchmark
+
+auto main() -> int
+{
+    using namespace cerb::benchmark;
+    using cerb::amd64::getSimdLevel;
+    using cerb::SimdLevel;
+
+    auto level = getSimdLevel();
+
+    if (level >= SimdLevel::SSE2) {
+        benchmarkKernels<sse2Kernels>("sse2");
+    }
+
+    if (level >= SimdLevel::AVX2) {
+        benchmarkKernels<avx2Kernels>("avx2");
+    }
+
+    if (level >= SimdLevel::AVX512) {
+        benchmarkKernels<avx512Kernels>("avx512");
+    }
+
+    return 0;
+}
+#else
+auto main() -> int
+{
+    fmt::print("cerberus is built without simd kernels\n");
+    return 0;
+}
+#endif /* CERBLIB_SIMD */
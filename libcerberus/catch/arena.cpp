@@ -0,0 +1,110 @@
+#include <cerberus/arena.hpp>
+#include <cerberus/debug/debug.hpp>
+#include <string>
+#include <thread>
+
+namespace cerb::debug
+{
+    struct ArenaCounter
+    {
+        ArenaCounter(Arena &arena, size_t &destroyed, u32 depth) : destroyed_objects(destroyed)
+        {
+            if (depth != 0) {
+                child = arena.create<ArenaCounter>(arena, destroyed, depth - 1U);
+            }
+        }
+
+        ArenaCounter(ArenaCounter const &) = delete;
+        ArenaCounter(ArenaCounter &&) noexcept = delete;
+
+        ~ArenaCounter()
+        {
+            ++destroyed_objects;
+        }
+
+        auto operator=(ArenaCounter const &) -> ArenaCounter & = delete;
+        auto operator=(ArenaCounter &&) noexcept -> ArenaCounter & = delete;
+
+        size_t &destroyed_objects;
+        ArenaCounter *child{};
+    };
+
+    auto testArenaOwnsObjects() -> void
+    {
+        size_t destroyed = 0;
+
+        {
+            Arena arena{};
+            auto *root = arena.create<ArenaCounter>(arena, destroyed, 3U);
+
+            ASSERT_EQUAL(arena.size(), 4);
+            ASSERT_NOT_EQUAL(root->child, nullptr);
+            ASSERT_NOT_EQUAL(root->child->child->child, nullptr);
+            ASSERT_EQUAL(root->child->child->child->child, nullptr);
+
+            auto *str = arena.create<std::string>(Arena::initial_buffer_size * 2, 'a');
+            auto *number = arena.create<u64>(42U);
+
+            ASSERT_EQUAL(str->size(), Arena::initial_buffer_size * 2);
+            ASSERT_EQUAL(*number, 42U);
+            ASSERT_EQUAL(reinterpret_cast<uintptr_t>(number) % alignof(u64), 0);
+            ASSERT_EQUAL(destroyed, 0);
+        }
+
+        ASSERT_EQUAL(destroyed, 4);
+    }
+
+    auto testArenaFromSeveralThreads() -> void
+    {
+        constexpr size_t number_of_threads = 4;
+        constexpr size_t objects_per_thread = 1000;
+
+        size_t destroyed[number_of_threads] = {};
+
+        {
+            Arena arena{};
+            std::vector<std::thread> threads{};
+
+            for (size_t i = 0; i != number_of_threads; ++i) {
+                threads.emplace_back([&arena, &destroyed, i]() {
+                    for (size_t j = 0; j != objects_per_thread; ++j) {
+                        CERBLIB_UNUSED(auto) = arena.create<ArenaCounter>(arena, destroyed[i], 0U);
+                    }
+                });
+            }
+
+            for (auto &thread : threads) {
+                thread.join();
+            }
+
+            ASSERT_EQUAL(arena.size(), number_of_threads * objects_per_thread);
+        }
+
+        for (size_t count : destroyed) {
+            ASSERT_EQUAL(count, objects_per_thread);
+        }
+    }
+
+    auto testArenaClear() -> void
+    {
+        size_t destroyed = 0;
+        Arena arena{};
+
+        CERBLIB_UNUSED(auto) = arena.create<ArenaCounter>(arena, destroyed, 2U);
+        arena.clear();
+
+        ASSERT_EQUAL(arena.size(), 0);
+        ASSERT_EQUAL(destroyed, 3);
+
+        CERBLIB_UNUSED(auto) = arena.create<ArenaCounter>(arena, destroyed, 0U);
+        ASSERT_EQUAL(arena.size(), 1);
+    }
+
+    auto testArena() -> int
+    {
+        testArenaOwnsObjects();
+        testArenaClear();
+        testArenaFromSeveralThreads();
+        return 0;
+    }
+}// namespace cerb::debug
@@ -1,5 +1,6 @@
 #include <cerberus/bitmap.hpp>
 #include <cerberus/debug/debug.hpp>
+#include <vector>
 
 namespace cerb::debug
 {
@@ -38,9 +39,142 @@ namespace cerb::debug
         return true;
     }
 
+    CERBERUS_TEST_FUNC_WITH_CONSTEXPR_VECTOR(testBitmapMultiSet)
+    {
+        Bitmap bitmap{};
+
+        // NOLINTBEGIN
+
+        bitmap.multiSet<1>(3, 1030);
+
+        ASSERT_FALSE(bitmap.at(2));
+        ASSERT_TRUE(bitmap.at(3));
+        ASSERT_TRUE(bitmap.at(64));
+        ASSERT_TRUE(bitmap.at(1029));
+        ASSERT_FALSE(bitmap.at(1030));
+
+        bitmap.multiSet<0>(60, 70);
+
+        ASSERT_TRUE(bitmap.at(59));
+        ASSERT_FALSE(bitmap.at(60));
+        ASSERT_FALSE(bitmap.at(69));
+        ASSERT_TRUE(bitmap.at(70));
+
+        bitmap.multiSet<0>(5, 6);
+
+        ASSERT_TRUE(bitmap.at(4));
+        ASSERT_FALSE(bitmap.at(5));
+        ASSERT_TRUE(bitmap.at(6));
+
+        // NOLINTEND
+
+        return true;
+    }
+
+    CERBERUS_TEST_FUNC_WITH_CONSTEXPR_VECTOR(testBitmapInlineStorage)
+    {
+        Bitmap bitmap{};
+
+        // NOLINTBEGIN
+
+        bitmap.set<1>(0);
+        bitmap.set<1>(127);
+        bitmap.set<1>(255);
+        ASSERT_TRUE(bitmap.isInline());
+
+        bitmap.set<1>(256);
+        ASSERT_FALSE(bitmap.isInline());
+
+        ASSERT_TRUE(bitmap.at(0));
+        ASSERT_TRUE(bitmap.at(127));
+        ASSERT_TRUE(bitmap.at(255));
+        ASSERT_TRUE(bitmap.at(256));
+        ASSERT_FALSE(bitmap.at(128));
+
+        auto copy = bitmap;
+        copy.set<0>(256);
+
+        ASSERT_TRUE(bitmap.at(256));
+        ASSERT_FALSE(copy.at(256));
+        ASSERT_TRUE(copy.at(255));
+
+        // NOLINTEND
+
+        return true;
+    }
+
+    auto testBitmapMultiSetOnEveryRange() -> void
+    {
+        constexpr size_t max_index = 200;
+
+        for (size_t from = 0; from < max_index; from += 7) {
+            for (size_t to = from; to != max_index; ++to) {
+                Bitmap bitmap{};
+                bitmap.multiSet<1>(from, to);
+
+                ASSERT_EQUAL(bitmap.popCount(), to - from);
+
+                for (size_t i = 0; i != max_index; ++i) {
+                    ASSERT_EQUAL(bitmap.at(i), logicalAnd(i >= from, i < to));
+                }
+            }
+        }
+    }
+
+    auto createBitmap(std::initializer_list<size_t> const &indexes) -> Bitmap
+    {
+        Bitmap bitmap{};
+
+        for (size_t index : indexes) {
+            bitmap.set<1>(index);
+        }
+
+        return bitmap;
+    }
+
+    auto expectSetBits(Bitmap const &bitmap, std::initializer_list<size_t> const &expected)
+        -> void
+    {
+        std::vector<size_t> set_bits{};
+
+        for (size_t index : bitmap.setBits()) {
+            set_bits.push_back(index);
+        }
+
+        ASSERT_TRUE(std::ranges::equal(set_bits, expected));
+    }
+
+    auto testBitmapAlgebra() -> void
+    {
+        // NOLINTBEGIN
+
+        auto const small = createBitmap({ 1, 5, 64, 100 });
+        auto const large = createBitmap({ 5, 100, 101, 700, 2000 });
+
+        expectSetBits(small & large, { 5, 100 });
+        expectSetBits(large & small, { 5, 100 });
+        expectSetBits(small | large, { 1, 5, 64, 100, 101, 700, 2000 });
+        expectSetBits(small ^ large, { 1, 64, 101, 700, 2000 });
+        expectSetBits(Bitmap{ large }.andNot(small), { 101, 700, 2000 });
+        expectSetBits(Bitmap{ small }.andNot(large), { 1, 64 });
+        expectSetBits(Bitmap{}, {});
+        expectSetBits(createBitmap({ 3, 200 }) | large, { 3, 5, 100, 101, 200, 700, 2000 });
+        expectSetBits(large & createBitmap({ 5, 200 }), { 5 });
+
+        ASSERT_EQUAL(small.popCount(), 4U);
+        ASSERT_EQUAL(large.popCount(), 5U);
+        ASSERT_EQUAL((small | large).popCount(), 7U);
+
+        // NOLINTEND
+    }
+
     auto testBitmap() -> int
     {
         CERBERUS_TEST_FOR_CONSTEXPR_VECTOR(testBitmapSetAndAt());
+        CERBERUS_TEST_FOR_CONSTEXPR_VECTOR(testBitmapMultiSet());
+        CERBERUS_TEST_FOR_CONSTEXPR_VECTOR(testBitmapInlineStorage());
+        testBitmapMultiSetOnEveryRange();
+        testBitmapAlgebra();
         return 0;
     }
 }// namespace cerb::debug
@@ -1,5 +1,7 @@
 #include <cerberus/const_bitmap.hpp>
 #include <cerberus/debug/debug.hpp>
+#include <random>
+#include <vector>
 
 namespace cerb::debug
 {
@@ -89,12 +91,110 @@ namespace cerb::debug
         return true;
     }
 
+    CERBLIB_DECL auto testBitMapFindNext() -> bool
+    {
+        // NOLINTBEGIN
+        ConstBitmap<2, 1000> bitmap;
+
+        bitmap.set<1, 0>(3);
+        bitmap.set<1, 0>(700);
+        bitmap.set<1, 0>(999);
+        bitmap.set<1, 1>(700);
+
+        ASSERT_TRUE(safeEqual<size_t>(bitmap.findNext<ValueOfBit::ONE, ValueOfBit::ZERO>(0), 3));
+        ASSERT_TRUE(safeEqual<size_t>(bitmap.findNext<ValueOfBit::ONE, ValueOfBit::ZERO>(4), 999));
+        ASSERT_TRUE(safeEqual<size_t>(bitmap.findNext<ValueOfBit::ONE, ValueOfBit::ONE>(3), 700));
+        ASSERT_TRUE(safeEqual<size_t>(bitmap.findNext<ValueOfBit::ONE, ValueOfBit::ONE>(700), 700));
+
+        ASSERT_TRUE(safeEqual(
+            bitmap.findNext<ValueOfBit::ONE, ValueOfBit::ONE>(701), bitmap.npos));
+        ASSERT_TRUE(safeEqual(
+            bitmap.findNext<ValueOfBit::ZERO, ValueOfBit::ZERO>(999), bitmap.npos));
+        ASSERT_TRUE(safeEqual(
+            bitmap.findNext<ValueOfBit::ANY, ValueOfBit::ANY>(1000), bitmap.npos));
+
+        size_t matches = 0;
+
+        for (size_t index : bitmap.matches<ValueOfBit::ONE, ValueOfBit::ANY>()) {
+            ASSERT_TRUE(bitmap.at<0>(index));
+            ++matches;
+        }
+
+        ASSERT_EQUAL(matches, 3);
+        // NOLINTEND
+
+        return true;
+    }
+
+    template<ValueOfBit... BitValues, size_t AxisN, size_t BitN>
+    auto expectMatches(ConstBitmap<AxisN, BitN> const &bitmap) -> void
+    {
+        constexpr std::array<ValueOfBit, AxisN> values = { BitValues... };
+
+        auto has_values = [&bitmap, &values]<size_t... Axis>(
+                              size_t index, std::index_sequence<Axis...>) {
+            return (
+                (values[Axis] == ValueOfBit::ANY ||
+                 bitmap.template at<Axis>(index) == (values[Axis] == ValueOfBit::ONE)) &&
+                ...);
+        };
+
+        std::vector<size_t> expected{};
+        std::vector<size_t> found{};
+
+        for (size_t index = 0; index != BitN; ++index) {
+            if (has_values(index, std::make_index_sequence<AxisN>{})) {
+                expected.push_back(index);
+            }
+        }
+
+        for (size_t index : bitmap.template matches<BitValues...>()) {
+            found.push_back(index);
+        }
+
+        ASSERT_TRUE(found == expected);
+
+        for (size_t from = 0; from <= BitN; from += 13) {
+            auto next = std::ranges::lower_bound(expected, from);
+            auto expected_index = next == expected.end() ? bitmap.npos : *next;
+
+            ASSERT_EQUAL(bitmap.template findNext<BitValues...>(from), expected_index);
+        }
+    }
+
+    auto testBitMapMatchesOnRandomBits() -> void
+    {
+        constexpr size_t bit_n = 1000;
+        constexpr size_t iterations = 50;
+
+        std::mt19937 engine{ 0 };// NOLINT
+        std::uniform_int_distribution<size_t> distribution{ 0, bit_n - 1 };
+
+        for (size_t iteration = 0; iteration != iterations; ++iteration) {
+            ConstBitmap<3, bit_n> bitmap;
+            auto density = iteration * 20;
+
+            for (size_t i = 0; i != density; ++i) {
+                bitmap.set<1, 0>(distribution(engine));
+                bitmap.set<1, 1>(distribution(engine));
+                bitmap.set<1, 2>(distribution(engine));
+            }
+
+            expectMatches<ValueOfBit::ONE, ValueOfBit::ONE, ValueOfBit::ONE>(bitmap);
+            expectMatches<ValueOfBit::ONE, ValueOfBit::ZERO, ValueOfBit::ANY>(bitmap);
+            expectMatches<ValueOfBit::ZERO, ValueOfBit::ZERO, ValueOfBit::ZERO>(bitmap);
+            expectMatches<ValueOfBit::ANY, ValueOfBit::ANY, ValueOfBit::ONE>(bitmap);
+        }
+    }
+
     auto testConstBitmap() -> int
     {
         CERBERUS_TEST(testBitMapSet());
         CERBERUS_TEST(testBitMapAt());
         CERBERUS_TEST(testBitMapClear());
         CERBERUS_TEST(testBitMapFind());
+        CERBERUS_TEST(testBitMapFindNext());
+        testBitMapMatchesOnRandomBits();
         return 0;
     }
 }// namespace cerb::debug
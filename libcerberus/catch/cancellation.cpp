@@ -0,0 +1,67 @@
+#include <cerberus/cancellation.hpp>
+#include <cerberus/debug/debug.hpp>
+
+namespace cerb::debug
+{
+    auto testDefaultCancellationToken() -> void
+    {
+        CancellationToken token{};
+
+        ASSERT_FALSE(token.isCancelled());
+        token.throwIfCancelled();
+    }
+
+    auto testStoppedCancellationToken() -> void
+    {
+        std::stop_source stop_source{};
+        CancellationToken token{ stop_source.get_token() };
+
+        ASSERT_FALSE(token.isCancelled());
+        stop_source.request_stop();
+        ASSERT_TRUE(token.isCancelled());
+
+        ERROR_EXPECTED(
+            token.throwIfCancelled(), OperationCancelledError, "Operation has been cancelled!");
+    }
+
+    auto testCancellationTokenDeadline() -> void
+    {
+        using namespace std::chrono_literals;
+
+        CancellationToken token = CancellationToken{}.withTimeout(1h);
+        ASSERT_FALSE(token.isCancelled());
+
+        token = token.withDeadline(CancellationToken::clock::now() - 1ms);
+        ASSERT_TRUE(token.isCancelled());
+
+        ERROR_EXPECTED(
+            token.throwIfCancelled(), OperationCancelledError,
+            "Operation deadline has been exceeded!");
+    }
+
+    auto testCancellationCheckpoint() -> void
+    {
+        constexpr size_t check_interval = 16;
+
+        std::stop_source stop_source{};
+        CancellationToken token{ stop_source.get_token() };
+        CancellationCheckpoint checkpoint{ token, check_interval };
+
+        stop_source.request_stop();
+
+        for (size_t i = 1; i != check_interval; ++i) {
+            checkpoint.tick();
+        }
+
+        ERROR_EXPECTED(checkpoint.tick(), OperationCancelledError, "Operation has been cancelled!");
+    }
+
+    auto testCancellation() -> int
+    {
+        testDefaultCancellationToken();
+        testStoppedCancellationToken();
+        testCancellationTokenDeadline();
+        testCancellationCheckpoint();
+        return 0;
+    }
+}// namespace cerb::debug
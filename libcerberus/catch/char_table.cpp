@@ -0,0 +1,64 @@
+#include <cerberus/char_table.hpp>
+#include <cerberus/debug/debug.hpp>
+
+namespace cerb::debug
+{
+    CERBERUS_TEST_FUNC(testCharTableOfBytes)
+    {
+        // NOLINTBEGIN
+        CharTable<char, int> table{ { { 'a', 1 }, { '\xFF', 2 } }, -1 };
+
+        ASSERT_EQUAL(table['a'], 1);
+        ASSERT_EQUAL(table['\xFF'], 2);
+        ASSERT_EQUAL(table['b'], -1);
+        ASSERT_EQUAL(table['\0'], -1);
+
+        table.setRange('0', '9', 3);
+        ASSERT_EQUAL(table['0'], 3);
+        ASSERT_EQUAL(table['9'], 3);
+        ASSERT_EQUAL(table[':'], -1);
+        // NOLINTEND
+
+        return true;
+    }
+
+    CERBERUS_TEST_FUNC(testCharTableOfWideChars)
+    {
+        // NOLINTBEGIN
+        CharTable<char32_t, int, 3> table{ { { U'a', 1 }, { U'а', 2 } }, -1 };
+
+        ASSERT_EQUAL(table[U'a'], 1);
+        ASSERT_EQUAL(table[U'а'], 2);
+        ASSERT_EQUAL(table[U'б'], -1);
+        ASSERT_EQUAL(table[U'š'], -1);
+        ASSERT_EQUAL(table[U'\U0001F600'], -1);
+        ASSERT_EQUAL(table[static_cast<char32_t>(0x8000'0000)], -1);
+        // NOLINTEND
+
+        return true;
+    }
+
+    auto testCharTableLimits() -> void
+    {
+        // NOLINTBEGIN
+        CharTable<char16_t, int> table{ -1 };
+        table.set(u'a', 1);
+
+        ERROR_EXPECTED(table.set(u'а', 2), std::out_of_range, "Cerberus char table is full!")
+
+        CharTable<char32_t, int> wide_table{ -1 };
+
+        ERROR_EXPECTED(
+            wide_table.set(U'\U0001F600', 1), std::out_of_range,
+            "Cerberus char table supports only 16-bit codes!")
+        // NOLINTEND
+    }
+
+    auto testCharTable() -> int
+    {
+        CERBERUS_TEST(testCharTableOfBytes());
+        CERBERUS_TEST(testCharTableOfWideChars());
+        testCharTableLimits();
+        return 0;
+    }
+}// namespace cerb::debug
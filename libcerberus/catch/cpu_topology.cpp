@@ -0,0 +1,40 @@
+#include <cerberus/cpu_topology.hpp>
+#include <cerberus/debug/debug.hpp>
+
+namespace cerb::debug
+{
+    auto testParseCpuList() -> void
+    {
+        ASSERT_TRUE(parseCpuList("").empty());
+        ASSERT_TRUE(parseCpuList("0") == std::vector<u32>{ 0 });
+        ASSERT_TRUE(parseCpuList("0-3") == (std::vector<u32>{ 0, 1, 2, 3 }));
+        ASSERT_TRUE(parseCpuList("0-1,4,6-7") == (std::vector<u32>{ 0, 1, 4, 6, 7 }));
+        ASSERT_TRUE(parseCpuList("2,x,3-") == std::vector<u32>{ 2 });
+        ASSERT_TRUE(parseCpuList("5-3,1") == std::vector<u32>{ 1 });
+        ASSERT_TRUE(parseCpuList("0-4294967295,7") == std::vector<u32>{ 7 });
+        ASSERT_TRUE(parseCpuList("4294967295,8192").empty());
+        ASSERT_EQUAL(parseCpuList("0-8191").size(), MaxNumberOfCpus);
+    }
+
+    auto testLoadCpuTopology() -> void
+    {
+        auto topology = CpuTopology::load();
+
+        ASSERT_TRUE(topology.numberOfNodes() >= 1);
+
+        for (size_t node = 0; node != topology.numberOfNodes(); ++node) {
+            ASSERT_FALSE(topology.getNodeCpus(node).empty());
+
+            for (u32 cpu : topology.getNodeCpus(node)) {
+                ASSERT_EQUAL(topology.findNodeOfCpu(cpu), node);
+            }
+        }
+    }
+
+    auto testCpuTopology() -> int
+    {
+        testParseCpuList();
+        testLoadCpuTopology();
+        return 0;
+    }
+}// namespace cerb::debug
@@ -1,6 +1,10 @@
 #include <cerberus/cerberus.hpp>
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/flat_map.hpp>
+#include <map>
+#include <random>
+#include <ranges>
+#include <string_view>
 
 namespace cerb::debug
 {
@@ -35,10 +39,113 @@ namespace cerb::debug
         ERROR_EXPECTED(flat_map.emplace(0, 0), std::out_of_range, "Cerberus flat map is full!")
     }
 
+    CERBERUS_TEST_FUNC(testSortedFlatMapOfInts)
+    {
+        // NOLINTBEGIN
+        SortedFlatMap<int, int, 8> flat_map{ { 30, 3 }, { 10, 1 }, { 20, 2 }, { 10, 4 } };
+
+        ASSERT_EQUAL(flat_map.size(), 3);
+        ASSERT_EQUAL(flat_map.getKeys()[0], 10);
+        ASSERT_EQUAL(flat_map.getKeys()[2], 30);
+
+        ASSERT_EQUAL(flat_map[10], 1);
+        ASSERT_EQUAL(flat_map[30], 3);
+        ASSERT_FALSE(flat_map.contains(25));
+
+        flat_map[25] = 5;
+        ASSERT_EQUAL(flat_map[25], 5);
+        ASSERT_EQUAL(flat_map.getKeys()[2], 25);
+        ASSERT_EQUAL(std::as_const(flat_map).at(30), 3);
+
+        ASSERT_EQUAL(flat_map[0], 0);
+        ASSERT_EQUAL(flat_map.getKeys()[0], 0);
+        ASSERT_EQUAL(flat_map.size(), 5);
+        // NOLINTEND
+
+        return true;
+    }
+
+    template<typename Key, size_t Size, typename KeyGenerator>
+    auto testSortedFlatMapAgainstStdMap(KeyGenerator &&generate_key) -> void
+    {
+        SortedFlatMap<Key, size_t, Size> flat_map{};
+        std::map<Key, size_t> std_map{};
+
+        for (size_t i = 0; i != Size; ++i) {
+            auto key = generate_key();
+
+            flat_map.emplace(key, i);
+            std_map.emplace(key, i);
+
+            ASSERT_EQUAL(flat_map.size(), std_map.size());
+        }
+
+        for (size_t i = 0; i != Size * 2; ++i) {
+            auto key = generate_key();
+            auto std_elem = std_map.find(key);
+
+            if (std_elem == std_map.end()) {
+                ASSERT_FALSE(flat_map.contains(key));
+            } else {
+                ASSERT_EQUAL(std::as_const(flat_map).at(key), std_elem->second);
+            }
+        }
+
+        ASSERT_TRUE(std::ranges::equal(flat_map.getKeys(), std_map | std::views::keys));
+    }
+
+    auto testSortedFlatMapOnRandomKeys() -> void
+    {
+        constexpr std::array<std::string_view, 8> words = { "if",    "else",  "for",   "while",
+                                                            "do",    "break", "const", "return" };
+
+        std::mt19937 engine{ 0 };// NOLINT
+        std::uniform_int_distribution<u32> small_keys{ 0, 64 };
+        std::uniform_int_distribution<u32> large_keys{ 0, 1000 };
+        std::uniform_int_distribution<size_t> word_index{ 0, words.size() - 1 };
+
+        auto small_key = [&]() { return small_keys(engine); };
+        auto large_key = [&]() { return large_keys(engine); };
+        auto byte_key = [&]() { return static_cast<u8>(large_keys(engine)); };
+        auto word_key = [&]() { return words[word_index(engine)]; };
+
+        testSortedFlatMapAgainstStdMap<u32, 32>(small_key);
+        testSortedFlatMapAgainstStdMap<u32, 300>(large_key);
+        testSortedFlatMapAgainstStdMap<u8, 200>(byte_key);
+        testSortedFlatMapAgainstStdMap<std::string_view, 8>(word_key);
+    }
+
+    auto testSortedFlatMapOfLimitKeys() -> void
+    {
+        constexpr auto max_key = std::numeric_limits<u32>::max();
+
+        SortedFlatMap<u32, u32, 3> full_map{ { 0, 0 }, { 7, 1 }, { 10, 2 } };
+        ASSERT_FALSE(full_map.contains(11));
+        ASSERT_FALSE(full_map.contains(max_key));
+
+        SortedFlatMap<u32, u32, 3> map_with_max_key{ { 0, 0 }, { max_key, 1 } };
+        ASSERT_FALSE(map_with_max_key.contains(7));
+        ASSERT_EQUAL(std::as_const(map_with_max_key).at(max_key), 1U);
+    }
+
+    auto testSortedFlatMapThrowOnFull() -> void
+    {
+        SortedFlatMap<int, int, 1> flat_map{};
+        flat_map.insert({ 0, 0 });
+        flat_map.insert({ 0, 1 });
+
+        ERROR_EXPECTED(flat_map.emplace(1, 0), std::out_of_range, "Cerberus flat map is full!")
+    }
+
     auto testFlatMap() -> int
     {
         CERBERUS_TEST(testFlatMapOfInts());
         testFlatMapThrowOnFull();
+
+        CERBERUS_TEST(testSortedFlatMapOfInts());
+        testSortedFlatMapOnRandomKeys();
+        testSortedFlatMapOfLimitKeys();
+        testSortedFlatMapThrowOnFull();
         return 0;
     }
 }// namespace cerb::debug
\ No newline at end of file
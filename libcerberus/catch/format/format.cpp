@@ -1,5 +1,9 @@
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/format/format.hpp>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <random>
 
 namespace cerb::debug
 {
@@ -84,8 +88,229 @@ namespace cerb::debug
         return true;
     }
 
+    CERBERUS_TEST_FUNC_WITH_CONSTEXPR_STRING(testFormattingEscapedBrackets)
+    {
+        ASSERT_EQUAL(fmt::format<char>("{{{}}} }}{{", 10), "{10} }{");
+        ASSERT_EQUAL(fmt::format<char16_t>("{{{}}}", 10), u"{10}");
+        return true;
+    }
+
+    CERBERUS_TEST_FUNC_WITH_CONSTEXPR_STRING(testFormattingToString)
+    {
+        std::string result = "[";
+        fmt::formatTo(result, "{} {}", 10, TestArrayOfInts);
+        fmt::formatTo(result, "]");
+
+        ASSERT_EQUAL(result, "[10 [10, 20, 30, 40]]");
+        return true;
+    }
+
+    CERBERUS_TEST_FUNC(testFormattingToArraySink)
+    {
+        std::array<char, 16> buffer{};
+        auto sink = fmt::ArraySink<char>{ buffer };
+
+        fmt::formatTo(sink, "{}: {}", -42, Pair{ 1, 2 });
+        ASSERT_EQUAL(sink.view().strView(), "-42: {1, 2}");
+        return true;
+    }
+
+    auto testFormattingToSinks() -> void
+    {
+        std::vector<char16_t> vector_sink{};
+        fmt::formatTo(vector_sink, "{{{}}}", std::vector{ 1, 2 });
+        ASSERT_EQUAL(std::u16string_view(vector_sink.data(), vector_sink.size()), u"{[1, 2]}");
+
+        std::array<char, 4> buffer{};
+        auto array_sink = fmt::ArraySink<char>{ buffer };
+
+        ERROR_EXPECTED(
+            fmt::formatTo(array_sink, "{}", 123456), fmt::FmtConverterError,
+            "Cerberus format buffer is full!");
+        ASSERT_EQUAL(array_sink.view().strView(), "1234");
+
+        auto nested = std::vector<std::vector<int>>{ { 1, 22 }, {}, { -333 } };
+        auto converted = fmt::convert<char>(nested);
+
+        ASSERT_EQUAL(converted, "[[1, 22], [], [-333]]");
+        ASSERT_EQUAL(fmt::estimateSize(nested), converted.size());
+    }
+
+    constexpr auto testFormatStringSegments() -> void
+    {
+        constexpr fmt::FormatString<int, int> formatter = "a{{b{}cd{}";
+        constexpr auto segments = formatter.getSegments();
+
+        static_assert(formatter.getLiteralsSize() == 5);
+
+        static_assert(segments[0].offset == 0);
+        static_assert(segments[0].length == 4);
+        static_assert(segments[0].has_escapes);
+
+        static_assert(segments[1].offset == 6);
+        static_assert(segments[1].length == 2);
+        static_assert(not segments[1].has_escapes);
+
+        static_assert(segments[2].offset == 10);
+        static_assert(segments[2].length == 0);
+    }
+
+    template<std::integral Int>
+    auto expectToCharsEqualsStd(Int number) -> void
+    {
+        std::array<char, fmt::max_chars_in_int<Int>> buffer{};
+        std::array<char, fmt::max_chars_in_int<Int>> expected{};
+
+        auto *end = fmt::toChars(number, buffer.data());
+        auto [expected_end, error] = std::to_chars(expected.begin(), expected.end(), number);
+
+        ASSERT_EQUAL(
+            std::string_view(buffer.data(), end),
+            std::string_view(expected.data(), expected_end));
+    }
+
+    template<std::integral Int>
+    auto testToCharsOnBorders() -> void
+    {
+        using limits = std::numeric_limits<Int>;
+
+        expectToCharsEqualsStd<Int>(0);
+        expectToCharsEqualsStd<Int>(limits::max());
+        expectToCharsEqualsStd<Int>(limits::min());
+
+        for (Int power = 1; power <= limits::max() / 10; power *= 10) {
+            expectToCharsEqualsStd<Int>(power - 1);
+            expectToCharsEqualsStd<Int>(power);
+            expectToCharsEqualsStd<Int>(static_cast<Int>(power * 10 - 1));
+
+            if constexpr (std::is_signed_v<Int>) {
+                expectToCharsEqualsStd<Int>(static_cast<Int>(-power));
+            }
+        }
+    }
+
+    auto testToChars() -> void
+    {
+        testToCharsOnBorders<i8>();
+        testToCharsOnBorders<u8>();
+        testToCharsOnBorders<i16>();
+        testToCharsOnBorders<u16>();
+        testToCharsOnBorders<i32>();
+        testToCharsOnBorders<u32>();
+        testToCharsOnBorders<i64>();
+        testToCharsOnBorders<u64>();
+
+        std::mt19937_64 engine{ 42 };// NOLINT
+
+        for (size_t i = 0; i != 10'000; ++i) {
+            auto value = engine();
+
+            expectToCharsEqualsStd(value >> (i % 64));
+            expectToCharsEqualsStd(static_cast<i64>(value) >> (i % 64));
+        }
+
+        static_assert(fmt::convert<char16_t>(-1234567) == u"-1234567");
+    }
+
+    auto getSignificantDigits(std::string_view number) -> std::string
+    {
+        std::string digits{};
+
+        for (char chr : number.substr(0, number.find('e'))) {
+            if (logicalAnd(chr >= '0', chr <= '9', logicalOr(chr != '0', not digits.empty()))) {
+                digits.push_back(chr);
+            }
+        }
+
+        return digits.substr(0, digits.find_last_not_of('0') + 1);
+    }
+
+    // digits must be the same as the shortest scientific digits of std::to_chars, but trailing
+    // zeros of integers are not replaced by the exact digits of the value
+    template<fmt::Ieee754Float Float>
+    auto expectFloatToCharsIsShortest(Float number) -> void
+    {
+        std::array<char, fmt::max_chars_in_float<Float>> buffer{};
+        std::array<char, fmt::max_chars_in_float<Float>> expected{};
+
+        auto *end = fmt::toChars(number, buffer.data());
+        auto result = std::string_view(buffer.data(), end);
+
+        auto [expected_end, error] = std::to_chars(
+            expected.begin(), expected.end(), number, std::chars_format::scientific);
+        auto expected_result = std::string_view(expected.data(), expected_end);
+
+        // std::from_chars of older libstdc++ does not parse subnormal values
+        auto result_string = std::string(result);
+        Float parsed{};
+
+        if constexpr (std::is_same_v<Float, f32>) {
+            parsed = std::strtof(result_string.c_str(), nullptr);
+        } else {
+            parsed = std::strtod(result_string.c_str(), nullptr);
+        }
+
+        ASSERT_EQUAL(getSignificantDigits(result), getSignificantDigits(expected_result));
+        ASSERT_TRUE(parsed == number);
+        ASSERT_EQUAL(std::signbit(parsed), std::signbit(number));
+    }
+
+    template<fmt::Ieee754Float Float>
+    auto expectFloatToChars(Float number, std::string_view expected) -> void
+    {
+        std::array<char, fmt::max_chars_in_float<Float>> buffer{};
+        auto *end = fmt::toChars(number, buffer.data());
+
+        ASSERT_EQUAL(std::string_view(buffer.data(), end), expected);
+    }
+
+    template<fmt::Ieee754Float Float, std::unsigned_integral Bits>
+    auto testFloatToCharsOnRandomBits() -> void
+    {
+        using limits = std::numeric_limits<Float>;
+
+        expectFloatToChars(limits::infinity(), "inf");
+        expectFloatToChars(-limits::infinity(), "-inf");
+        expectFloatToChars(limits::quiet_NaN(), "nan");
+        expectFloatToChars(static_cast<Float>(-0.0), "-0");
+        expectFloatToChars(static_cast<Float>(0.1), "0.1");
+        expectFloatToChars(static_cast<Float>(1e-7), "1e-07");
+        expectFloatToChars(static_cast<Float>(123456), "123456");
+        expectFloatToChars(static_cast<Float>(0.00125), "0.00125");
+        expectFloatToChars(static_cast<Float>(1e22), "1e+22");
+
+        for (auto value :
+             { limits::min(), limits::max(), limits::denorm_min(), limits::lowest() }) {
+            expectFloatToCharsIsShortest(value);
+        }
+
+        std::mt19937_64 engine{ 42 };// NOLINT
+
+        for (size_t i = 0; i != 100'000; ++i) {
+            auto value = std::bit_cast<Float>(static_cast<Bits>(engine()));
+
+            if (std::isfinite(value)) {
+                expectFloatToCharsIsShortest(value);
+            }
+        }
+    }
+
+    auto testFloatToChars() -> void
+    {
+        testFloatToCharsOnRandomBits<f32, u32>();
+        testFloatToCharsOnRandomBits<f64, u64>();
+
+        static_assert(fmt::convert<char16_t>(0.3) == u"0.3");
+        static_assert(fmt::convert<char>(-2.5e-20F) == "-2.5e-20");
+    }
+
     auto testFmt() -> int
     {
+        testFloatToChars();
+        testToChars();
+        testFormatStringSegments();
+        testFormattingToSinks();
+        CERBERUS_TEST(testFormattingToArraySink());
         CERBERUS_TEST_STD_STRING(testFormattingBasicChar());
         CERBERUS_TEST_STD_STRING(testFormattingOnIntBasicChar());
         CERBERUS_TEST_STD_STRING(testFormattingOnPairBasicChar());
@@ -100,6 +325,9 @@ namespace cerb::debug
         CERBERUS_TEST_STD_STRING(testFormattingOnStringUtf16Char());
         CERBERUS_TEST_STD_STRING(testFormattingMultiArgumentsUtf16Char());
 
+        CERBERUS_TEST_STD_STRING(testFormattingEscapedBrackets());
+        CERBERUS_TEST_STD_STRING(testFormattingToString());
+
         return 0;
     }
 }// namespace cerb::debug
@@ -108,6 +108,207 @@ namespace cerb::debug
         std::array<int, tasks_number> value_to_zero{};
     };
 
+    auto testLazyExecutorElasticScaling() -> void
+    {
+        using namespace std::chrono_literals;
+
+        constexpr size_t max_threads = 4;
+        constexpr size_t jobs_number = 256;
+        constexpr auto deadline = 5s;
+
+        std::atomic<size_t> finished_jobs{ 0 };
+        LazyExecutor<int> executor{ 1 };
+
+        executor.enableElasticScaling({ .min_threads = 1,
+                                        .max_threads = max_threads,
+                                        .latency_target = 2ms,
+                                        .idle_period = 50ms,
+                                        .check_period = 1ms });
+
+        for (size_t i = 0; i != jobs_number; ++i) {
+            executor.addJob([&finished_jobs]() {
+                std::this_thread::sleep_for(1ms);
+                return static_cast<int>(finished_jobs++);
+            });
+        }
+
+        size_t threads_peak = 1;
+        auto const start_time = std::chrono::steady_clock::now();
+
+        while (finished_jobs != jobs_number &&
+               std::chrono::steady_clock::now() - start_time < deadline) {
+            threads_peak = max(threads_peak, executor.threadsNumber());
+            std::this_thread::sleep_for(1ms);
+        }
+
+        ASSERT_TRUE(threads_peak > 1);
+        ASSERT_TRUE(threads_peak <= max_threads);
+
+        while (executor.threadsNumber() != 1 &&
+               std::chrono::steady_clock::now() - start_time < deadline) {
+            std::this_thread::sleep_for(5ms);
+        }
+
+        ASSERT_EQUAL(executor.threadsNumber(), 1);
+        executor.stop();
+        ASSERT_EQUAL(finished_jobs.load(), jobs_number);
+    }
+
+    auto testLazyExecutorPlacement() -> void
+    {
+        constexpr size_t jobs_number = 64;
+
+        std::atomic<size_t> named_jobs{ 0 };
+        auto const topology = CpuTopology::load();
+
+        LazyExecutor<int> executor{ 2, { .cpus = { 0 }, .thread_name = "cerb-lex" } };
+
+        for (size_t i = 0; i != jobs_number; ++i) {
+            executor.addJob([&named_jobs]() {
+#ifdef __linux__
+                std::array<char, 16> name{};
+                pthread_getname_np(pthread_self(), name.data(), name.size());
+                std::string_view thread_name{ name.data() };
+                named_jobs += static_cast<size_t>(thread_name.starts_with("cerb-lex-"));
+#else
+                ++named_jobs;
+#endif
+                return 0;
+            });
+        }
+
+        executor.stop();
+        ASSERT_EQUAL(named_jobs.load(), jobs_number);
+
+        LazyExecutor<int> numa_executor{ 2, { .numa_aware = true } };
+        ASSERT_EQUAL(numa_executor.queuesNumber(), topology.numberOfNodes());
+    }
+
+    constexpr int PriorityJobFlag = 100;
+
+    // order, in which a single thread executes jobs queued behind a blocking job, priority jobs
+    // are recorded as PriorityJobFlag + i
+    auto executeQueuedJobs(std::vector<size_t> const &weights, int jobs, int priority_jobs)
+        -> std::vector<int>
+    {
+        using namespace std::chrono_literals;
+
+        std::atomic<bool> started{ false };
+        std::atomic<bool> released{ false };
+        std::vector<int> execution_order{};
+        LazyExecutor<int> executor{ 1 };
+
+        if (not weights.empty()) {
+            executor.setPriorityLanes(weights);
+        }
+
+        executor.addJob([&started, &released]() {
+            started = true;
+            started.notify_one();
+
+            while (not released) {
+                std::this_thread::sleep_for(1ms);
+            }
+            return 0;
+        });
+
+        // wait until the blocking job is taken, so that every other job stays in the queue
+        started.wait(false);
+
+        for (int i = 0; i != jobs; ++i) {
+            executor.addJob([&execution_order, i]() {
+                execution_order.push_back(i);
+                return 0;
+            });
+        }
+
+        for (int i = 0; i != priority_jobs; ++i) {
+            executor.addPriorityJob([&execution_order, i]() {
+                execution_order.push_back(PriorityJobFlag + i);
+                return 0;
+            });
+        }
+
+        released = true;
+        executor.stop();
+
+        return execution_order;
+    }
+
+    auto testLazyExecutorPriorityLanes() -> void
+    {
+        constexpr int jobs_per_lane = 8;
+
+        auto execution_order = executeQueuedJobs({ 1, 1 }, jobs_per_lane, jobs_per_lane);
+
+        ASSERT_EQUAL(execution_order.size(), static_cast<size_t>(jobs_per_lane * 2));
+
+        for (int i = 0; i != jobs_per_lane; ++i) {
+            auto index = static_cast<size_t>(i * 2);
+            ASSERT_EQUAL(execution_order[index], PriorityJobFlag + i);
+            ASSERT_EQUAL(execution_order[index + 1], i);
+        }
+    }
+
+    // default lanes have weights { 1, 8 }, so every 9 jobs contain one job of the low lane
+    auto testLazyExecutorDefaultPriorityLanes() -> void
+    {
+        constexpr int jobs = 4;
+        constexpr int priority_jobs = 32;
+        constexpr ptrdiff_t round_length = 9;
+
+        auto execution_order = executeQueuedJobs({}, jobs, priority_jobs);
+        auto is_low_lane_job = [](int job) {
+            return job < PriorityJobFlag;
+        };
+
+        ASSERT_EQUAL(execution_order.size(), static_cast<size_t>(jobs + priority_jobs));
+
+        for (int i = 0; i != jobs; ++i) {
+            auto round_begin = execution_order.begin() + i * round_length;
+            auto round_end = round_begin + round_length;
+            auto low_lane_job = std::find_if(round_begin, round_end, is_low_lane_job);
+
+            ASSERT_TRUE(low_lane_job != round_end);
+            ASSERT_EQUAL(*low_lane_job, i);
+            ASSERT_EQUAL(std::count_if(round_begin, round_end, is_low_lane_job), 1);
+        }
+    }
+
+    auto testLazyExecutorCancellation() -> void
+    {
+        using namespace std::chrono_literals;
+
+        std::atomic<int> started_jobs{ 0 };
+        std::atomic<int> completed_jobs{ 0 };
+        std::stop_source stop_source{};
+        LazyExecutor<int> executor{ 2 };
+
+        auto count_completion = [&completed_jobs](int /*unused*/) { ++completed_jobs; };
+        auto endless_job = [&started_jobs](CancellationToken const &token) {
+            ++started_jobs;
+
+            while (true) {
+                token.throwIfCancelled();
+                std::this_thread::sleep_for(1ms);
+            }
+
+            return 0;
+        };
+
+        stop_source.request_stop();
+        executor.addCancellableJob(
+            endless_job, CancellationToken{ stop_source.get_token() }, count_completion);
+
+        executor.addCancellableJob(
+            endless_job, CancellationToken{}.withTimeout(500ms), count_completion);
+
+        executor.stop();
+
+        ASSERT_EQUAL(started_jobs.load(), 1);
+        ASSERT_EQUAL(completed_jobs.load(), 0);
+    }
+
     auto testLazyExecutor() -> int
     {
         LazyExecutorTester executor_test_default{ LazyExecutorOptions::DEFAULT };
@@ -115,6 +316,12 @@ namespace cerb::debug
         LazyExecutorTester executor_test_with_removed_thread{ LazyExecutorOptions::REMOVE_THREAD };
         LazyExecutorTester executor_test_with_joined_thread{ LazyExecutorOptions::JOIN };
 
+        testLazyExecutorElasticScaling();
+        testLazyExecutorPlacement();
+        testLazyExecutorPriorityLanes();
+        testLazyExecutorDefaultPriorityLanes();
+        testLazyExecutorCancellation();
+
         return 0;
     }
 }// namespace cerb::debug
\ No newline at end of file
@@ -1,5 +1,7 @@
 namespace cerb::debug
 {
+    auto testArena() -> int;
+    auto testCharTable() -> int;
     auto testEnum() -> int;
     auto testFlatMap() -> int;
     auto testForEach() -> int;
@@ -13,12 +15,16 @@ namespace cerb::debug
     auto testFmt() -> int;
 
     auto testLazyExecutor() -> int;
+    auto testCpuTopology() -> int;
+    auto testCancellation() -> int;
 }// namespace cerb::debug
 
 auto main() -> int
 {
     using namespace cerb::debug;
 
+    testArena();
+    testCharTable();
     testEnum();
     testFlatMap();
     testForEach();
@@ -31,6 +37,8 @@ auto main() -> int
 
     testFmt();
 
+    testCpuTopology();
+    testCancellation();
     testLazyExecutor();
 
     return 0;
@@ -2,6 +2,7 @@
 #include <cerberus/debug/random_values.hpp>
 #include <cerberus/memory.hpp>
 #include <cerberus/pointer_wrapper.hpp>
+#include <vector>
 
 namespace cerb::debug
 {
@@ -45,10 +46,30 @@ namespace cerb::debug
         return true;
     }
 
+    // buffers of that size are copied by the simd kernels instead of the standard library
+    auto testCopyOnLargeBuffer() -> bool
+    {
+        std::vector<u8> source(LargeBufferThreshold + 3);
+        std::vector<u8> dest(source.size());
+
+        for (size_t i = 0; i != source.size(); ++i) {
+            source[i] = static_cast<u8>(i * 7);
+        }
+
+        copy(dest.data() + 1, source.data() + 1, source.size() - 2);
+
+        ASSERT_EQUAL(dest.front(), 0);
+        ASSERT_EQUAL(dest.back(), 0);
+        ASSERT_TRUE(std::equal(source.begin() + 1, source.end() - 1, dest.begin() + 1));
+
+        return true;
+    }
+
     auto testCopy() -> int
     {
         CERBERUS_TEST(testCopyOnArray());
         CERBERUS_TEST(testCopyOnPointer());
+        ASSERT_TRUE(testCopyOnLargeBuffer());
         return 0;
     }
 }// namespace cerb::debug
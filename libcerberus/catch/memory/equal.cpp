@@ -27,10 +27,22 @@ namespace cerb::debug
         return true;
     }
 
+    CERBERUS_TEST_FUNC(testEqualOnEmptyString)
+    {
+        std::string_view empty_string{};
+
+        ASSERT_TRUE(equal(empty_string, std::string_view{}));
+        ASSERT_FALSE(equal(empty_string, std::string_view{ "a" }));
+        ASSERT_TRUE(find(empty_string.data(), 'a', 0) == empty_string.data());
+
+        return true;
+    }
+
     auto testEqual() -> int
     {
         CERBERUS_TEST(testEqualOnArrayOfInts());
         CERBERUS_TEST(testEqualOnString());
+        CERBERUS_TEST(testEqualOnEmptyString());
         return 0;
     }
 }// namespace cerb::debug
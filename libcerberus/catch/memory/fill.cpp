@@ -1,6 +1,7 @@
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/memory.hpp>
 #include <string>
+#include <vector>
 
 namespace cerb::debug
 {
@@ -85,12 +86,28 @@ namespace cerb::debug
         return true;
     }
 
+    // buffers of that size are filled by the simd kernels instead of the standard library
+    auto testFillOnLargeBuffer() -> bool
+    {
+        std::vector<u16> data(LargeBufferThreshold / sizeof(u16) + 3);
+        fill(data.data() + 1, static_cast<u16>(0xABCD), data.size() - 2);
+
+        ASSERT_EQUAL(data.front(), 0);
+        ASSERT_EQUAL(data.back(), 0);
+        ASSERT_TRUE(std::all_of(data.begin() + 1, data.end() - 1, [](u16 elem) {
+            return elem == 0xABCD;
+        }));
+
+        return true;
+    }
+
     auto testFill() -> int
     {
         CERBERUS_TEST(testFillOnArrayOfInts());
         CERBERUS_TEST(testFillOnArrayOfFloats());
         CERBERUS_TEST(testFillOnPointerOfInts());
         CERBERUS_TEST(testFillOnPointerOfFloats());
+        ASSERT_TRUE(testFillOnLargeBuffer());
 
         CERBERUS_TEST_STD_STRING(testFillOnArrayOfStrings());
         CERBERUS_TEST_STD_STRING(testFillOnPointerOfStrings());
@@ -1,3 +1,5 @@
+#include <cerberus/bitmap.hpp>
+#include <cerberus/const_bitmap.hpp>
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/memory.hpp>
 #include <cerberus/pair.hpp>
@@ -88,6 +90,65 @@ namespace cerb::debug
         return index == last_zero_index;
     }
 
+    CERBERUS_TEST_FUNC(testFindAnyOfOnStringView)
+    {
+        std::string_view str = "hello, world! [some text]";
+        std::string_view brackets = "[]";
+        std::string_view missing = "{}";
+
+        ASSERT_EQUAL(
+            findAnyOf(str.data(), str.size(), brackets.data(), brackets.size()),
+            str.data() + str.find('['));
+        ASSERT_EQUAL(
+            findAnyOf(str.data(), str.size(), missing.data(), missing.size()),
+            str.data() + str.size());
+
+        return true;
+    }
+
+    CERBERUS_TEST_FUNC(testFindClassOnStringView)
+    {
+        std::string_view str = "hello, world! [some text]";
+        CharClass const punctuation{ std::string_view{ ",!" } };
+
+        ASSERT_TRUE(punctuation.contains('!'));
+        ASSERT_FALSE(punctuation.contains(u'\u0121'));
+
+        ASSERT_EQUAL(findClass(str.data(), str.size(), punctuation), str.data() + str.find(','));
+        ASSERT_EQUAL(
+            findClass(str.data() + str.find(',') + 1, str.size() - str.find(',') - 1, punctuation),
+            str.data() + str.find('!'));
+
+        return true;
+    }
+
+    auto testFindClassOnBitmaps() -> void
+    {
+        std::u16string_view str = u"hello, world! [some text]";
+
+        ConstBitmap<1, 256> const_bitmap{};
+        const_bitmap.set<1, 0>(' ');
+
+        Bitmap bitmap{};
+        bitmap.set<1>('!');
+
+        ASSERT_EQUAL(
+            findClass(str.data(), str.size(), const_bitmap), str.data() + str.find(u' '));
+        ASSERT_EQUAL(findClass(str.data(), str.size(), bitmap), str.data() + str.find(u'!'));
+
+        std::string_view bytes = "hello, world! [some text]";
+        auto const space_class = toCharClass(const_bitmap);
+        auto const exclamation_class = toCharClass(bitmap);
+
+        ASSERT_TRUE(space_class.contains(' '));
+        ASSERT_FALSE(space_class.contains('!'));
+        ASSERT_EQUAL(
+            findClass(bytes.data(), bytes.size(), space_class), bytes.data() + bytes.find(' '));
+        ASSERT_EQUAL(
+            findClass(bytes.data(), bytes.size(), exclamation_class),
+            bytes.data() + bytes.find('!'));
+    }
+
     auto testFind() -> int
     {
         CERBERUS_TEST(testFindOnStringView());
@@ -98,6 +159,9 @@ namespace cerb::debug
         CERBERUS_TEST(testRfindOnStringView());
         CERBERUS_TEST(testRfindOnArrayOfInts());
         CERBERUS_TEST(testRfindOnArrayOfIntsWithNoSuitableInts());
+        CERBERUS_TEST(testFindAnyOfOnStringView());
+        CERBERUS_TEST(testFindClassOnStringView());
+        testFindClassOnBitmaps();
         return 0;
     }
 }// namespace cerb::debug
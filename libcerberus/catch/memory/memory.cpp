@@ -5,6 +5,7 @@ namespace cerb::debug
     auto testCopy() -> int;
     auto testPointerWrapper() -> int;
     auto testFind() -> int;
+    auto testSimd() -> int;
 
     auto memoryTest() -> int
     {
@@ -12,6 +13,7 @@ namespace cerb::debug
         testCopy();
         testEqual();
         testFind();
+        testSimd();
         testPointerWrapper();
         return 0;
     }
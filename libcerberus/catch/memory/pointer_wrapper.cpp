@@ -37,6 +37,18 @@ namespace cerb::debug
             return true;
         }());
 
+        auto other_pointer = pointer;
+        auto other_wrapper = RawPointerWrapper<int>(other_pointer.data(), test_array_size);
+
+        ASSERT_TRUE(pointer_wrapper == other_wrapper);
+        ASSERT_TRUE((pointer_wrapper <=> other_pointer) == 0);
+
+        other_pointer[test_array_size / 2] = pointer[test_array_size / 2] + 1;
+
+        ASSERT_FALSE(pointer_wrapper == other_wrapper);
+        ASSERT_TRUE((pointer_wrapper <=> other_pointer) < 0);
+        ASSERT_TRUE((other_wrapper <=> pointer) > 0);
+
         return 0;
     }
 }// namespace cerb::debug
\ No newline at end of file
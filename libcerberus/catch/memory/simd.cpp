@@ -0,0 +1,485 @@
+#include <cerberus/debug/debug.hpp>
+#include <cerberus/debug/random_array.hpp>
+#include <cerberus/memory.hpp>
+#include <numeric>
+
+namespace cerb::debug
+{
+#if CERBLIB_SIMD
+    static constexpr size_t MaxTestLength = 160;
+    static constexpr size_t LargeTestLength = NonTemporalThreshold * 2 + 40;
+
+    struct Sse2Kernels
+    {
+        static constexpr auto level = SimdLevel::SSE2;
+
+        template<typename T>
+        static auto fill(T *dest, T value, size_t times) -> void
+        {
+            amd64::sse2::fill(dest, value, times);
+        }
+
+        static auto copy(void *dest, void const *src, size_t bytes) -> void
+        {
+            amd64::sse2::copy(dest, src, bytes);
+        }
+
+        template<typename T>
+        static auto find(T const *location, T value, size_t limit) -> T const *
+        {
+            return amd64::sse2::find(location, value, limit);
+        }
+
+        static auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+        {
+            return amd64::sse2::mismatch(lhs, rhs, bytes);
+        }
+
+        template<typename T>
+        static auto search(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::sse2::search(location, limit, needle, length);
+        }
+
+        template<typename T>
+        static auto rsearch(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::sse2::rsearch(location, limit, needle, length);
+        }
+
+        template<BitwiseOperation Operation, typename T>
+        static auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+        {
+            amd64::sse2::bitwiseApply<Operation>(dest, src, length);
+        }
+
+        template<typename T>
+        static auto findAnyOf(T const *location, size_t limit, T const *needles, size_t count)
+            -> T const *
+        {
+            return amd64::sse2::findAnyOf(location, limit, needles, count);
+        }
+    };
+
+    struct Sse42Kernels : Sse2Kernels
+    {
+        static constexpr auto level = SimdLevel::SSE42;
+
+        template<typename T>
+        static auto findAnyOf(T const *location, size_t limit, T const *needles, size_t count)
+            -> T const *
+        {
+            return amd64::sse42::findAnyOf(location, limit, needles, count);
+        }
+
+        template<typename T>
+        static auto findClass(T const *location, size_t limit, CharClass const &char_class)
+            -> T const *
+        {
+            return amd64::sse42::findClass(location, limit, char_class);
+        }
+    };
+
+    struct Avx2Kernels
+    {
+        static constexpr auto level = SimdLevel::AVX2;
+
+        template<typename T>
+        static auto fill(T *dest, T value, size_t times) -> void
+        {
+            amd64::avx2::fill(dest, value, times);
+        }
+
+        static auto copy(void *dest, void const *src, size_t bytes) -> void
+        {
+            amd64::avx2::copy(dest, src, bytes);
+        }
+
+        template<typename T>
+        static auto find(T const *location, T value, size_t limit) -> T const *
+        {
+            return amd64::avx2::find(location, value, limit);
+        }
+
+        static auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+        {
+            return amd64::avx2::mismatch(lhs, rhs, bytes);
+        }
+
+        template<typename T>
+        static auto search(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::avx2::search(location, limit, needle, length);
+        }
+
+        template<typename T>
+        static auto rsearch(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::avx2::rsearch(location, limit, needle, length);
+        }
+
+        template<BitwiseOperation Operation, typename T>
+        static auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+        {
+            amd64::avx2::bitwiseApply<Operation>(dest, src, length);
+        }
+
+        template<typename T>
+        static auto findAnyOf(T const *location, size_t limit, T const *needles, size_t count)
+            -> T const *
+        {
+            return amd64::avx2::findAnyOf(location, limit, needles, count);
+        }
+
+        template<typename T>
+        static auto findClass(T const *location, size_t limit, CharClass const &char_class)
+            -> T const *
+        {
+            return amd64::avx2::findClass(location, limit, char_class);
+        }
+    };
+
+    struct Avx512Kernels
+    {
+        static constexpr auto level = SimdLevel::AVX512;
+
+        template<typename T>
+        static auto fill(T *dest, T value, size_t times) -> void
+        {
+            amd64::avx512::fill(dest, value, times);
+        }
+
+        static auto copy(void *dest, void const *src, size_t bytes) -> void
+        {
+            amd64::avx512::copy(dest, src, bytes);
+        }
+
+        template<typename T>
+        static auto find(T const *location, T value, size_t limit) -> T const *
+        {
+            return amd64::avx512::find(location, value, limit);
+        }
+
+        static auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+        {
+            return amd64::avx512::mismatch(lhs, rhs, bytes);
+        }
+
+        template<typename T>
+        static auto search(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::avx512::search(location, limit, needle, length);
+        }
+
+        template<typename T>
+        static auto rsearch(T const *location, size_t limit, T const *needle, size_t length)
+            -> T const *
+        {
+            return amd64::avx512::rsearch(location, limit, needle, length);
+        }
+
+        template<BitwiseOperation Operation, typename T>
+        static auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+        {
+            amd64::avx512::bitwiseApply<Operation>(dest, src, length);
+        }
+
+        template<typename T>
+        static auto findAnyOf(T const *location, size_t limit, T const *needles, size_t count)
+            -> T const *
+        {
+            return amd64::avx512::findAnyOf(location, limit, needles, count);
+        }
+    };
+
+    template<typename Kernels, typename T>
+    auto testSimdFill(T value) -> void
+    {
+        std::vector<T> data(MaxTestLength + 2);
+
+        for (size_t length = 0; length != MaxTestLength; ++length) {
+            std::ranges::fill(data, T{});
+            Kernels::fill(data.data() + 1, value, length);
+
+            ASSERT_EQUAL(data.front(), T{});
+            ASSERT_EQUAL(data[length + 1], T{});
+
+            auto const *filled = data.data() + 1;
+            ASSERT_EQUAL(static_cast<size_t>(std::count(filled, filled + length, value)), length);
+        }
+
+        std::vector<T> large_data(LargeTestLength);
+        Kernels::fill(large_data.data() + 1, value, LargeTestLength - 2);
+
+        ASSERT_EQUAL(large_data.front(), T{});
+        ASSERT_EQUAL(large_data.back(), T{});
+        ASSERT_EQUAL(
+            static_cast<size_t>(std::count(large_data.begin(), large_data.end(), value)),
+            LargeTestLength - 2);
+    }
+
+    template<typename Kernels>
+    auto testSimdCopy() -> void
+    {
+        auto const source = createRandomArrayOfInts<u8>(LargeTestLength);
+        std::vector<u8> dest(LargeTestLength);
+
+        for (size_t offset = 0; offset != 4; ++offset) {
+            for (size_t length = 0; length != MaxTestLength; ++length) {
+                std::fill(dest.begin(), dest.begin() + MaxTestLength * 2, 0);
+                Kernels::copy(dest.data() + offset, source.data(), length);
+
+                u8 const *copied = dest.data() + offset;
+                u8 const *checked_end = dest.data() + MaxTestLength * 2;
+
+                ASSERT_TRUE(std::equal(source.data(), source.data() + length, copied));
+                ASSERT_TRUE(std::all_of(copied + length, checked_end,
+                                        [](u8 elem) { return elem == 0; }));
+            }
+        }
+
+        std::ranges::fill(dest, 0);
+        Kernels::copy(dest.data() + 3, source.data() + 1, LargeTestLength - 4);
+
+        ASSERT_TRUE(std::equal(source.data() + 1, source.data() + LargeTestLength - 3,
+                               dest.data() + 3));
+        ASSERT_EQUAL(dest.back(), 0);
+    }
+
+    template<typename Kernels, typename T>
+    auto testSimdFind() -> void
+    {
+        auto const value_to_find = static_cast<T>(0x7F);
+        std::vector<T> data(MaxTestLength, static_cast<T>(1));
+
+        for (size_t length = 0; length != MaxTestLength; ++length) {
+            ASSERT_EQUAL(Kernels::find(data.data(), value_to_find, length), data.data() + length);
+
+            for (size_t position = 0; position < length; ++position) {
+                data[position] = value_to_find;
+
+                ASSERT_EQUAL(
+                    Kernels::find(data.data(), value_to_find, length),
+                    std::find(data.data(), data.data() + length, value_to_find));
+
+                data[position] = static_cast<T>(1);
+            }
+        }
+    }
+
+    template<typename Kernels>
+    auto testSimdMismatch() -> void
+    {
+        auto const first = createRandomArrayOfInts<u8>(MaxTestLength);
+        auto second = first;
+
+        for (size_t length = 0; length != MaxTestLength; ++length) {
+            ASSERT_EQUAL(Kernels::mismatch(first.data(), second.data(), length), length);
+
+            for (size_t position = 0; position < length; ++position) {
+                second[position] = static_cast<u8>(~second[position]);
+                second[length - 1] = static_cast<u8>(~first[length - 1]);
+
+                ASSERT_EQUAL(Kernels::mismatch(first.data(), second.data(), length), position);
+
+                second[position] = first[position];
+                second[length - 1] = first[length - 1];
+            }
+        }
+    }
+
+    template<typename Kernels, BitwiseOperation Operation>
+    auto testSimdBitwiseApply() -> void
+    {
+        constexpr size_t max_length = 40;
+
+        auto const dest = createRandomArrayOfInts<u64>(max_length);
+        auto const src = createRandomArrayOfInts<u64>(max_length);
+
+        for (size_t length = 0; length != max_length; ++length) {
+            auto result = dest;
+            auto expected = dest;
+
+            Kernels::template bitwiseApply<Operation>(result.data(), src.data(), length);
+            cerb::private_::bitwiseApplyScalar<Operation>(expected.data(), src.data(), length);
+
+            ASSERT_TRUE(result == expected);
+        }
+    }
+
+    template<typename Kernels, typename T>
+    auto testSimdSearch(size_t needle_length) -> void
+    {
+        constexpr size_t max_length = MaxTestLength / 2;
+
+        std::vector<T> needle(needle_length);
+        std::vector<T> data(max_length, static_cast<T>(1));
+
+        for (size_t i = 0; i != needle_length; ++i) {
+            needle[i] = static_cast<T>(i + 2);
+        }
+
+        auto const *needle_begin = needle.data();
+        auto const *needle_end = needle.data() + needle_length;
+
+        for (size_t length = needle_length; length != max_length; ++length) {
+            auto const *begin = data.data();
+            auto const *end = data.data() + length;
+
+            ASSERT_EQUAL(Kernels::search(data.data(), length, needle.data(), needle_length), end);
+            ASSERT_EQUAL(Kernels::rsearch(data.data(), length, needle.data(), needle_length), end);
+
+            for (size_t position = 0; position + needle_length <= length; position += 3) {
+                std::copy(needle_begin, needle_end, data.data() + position);
+                // a partial match, which differs only in the last element
+                data[position / 2] = needle.front();
+
+                ASSERT_EQUAL(
+                    Kernels::search(data.data(), length, needle.data(), needle_length),
+                    std::search(begin, end, needle_begin, needle_end));
+                ASSERT_EQUAL(
+                    Kernels::rsearch(data.data(), length, needle.data(), needle_length),
+                    std::find_end(begin, end, needle_begin, needle_end));
+
+                std::fill(data.begin(), data.end(), static_cast<T>(1));
+            }
+        }
+    }
+
+    template<typename Kernels, typename T>
+    auto testSimdFindAnyOf(size_t needles_count) -> void
+    {
+        constexpr size_t max_length = MaxTestLength / 2;
+
+        std::vector<T> needles(needles_count);
+        std::vector<T> data(max_length, static_cast<T>(1));
+
+        for (size_t i = 0; i != needles_count; ++i) {
+            needles[i] = static_cast<T>(i * 3 + 2);
+        }
+
+        for (size_t length = 0; length != max_length; ++length) {
+            ASSERT_EQUAL(
+                Kernels::findAnyOf(data.data(), length, needles.data(), needles_count),
+                data.data() + length);
+
+            for (size_t position = 0; position < length; ++position) {
+                data[position] = static_cast<T>(position * 3 + 2);
+
+                ASSERT_EQUAL(
+                    Kernels::findAnyOf(data.data(), length, needles.data(), needles_count),
+                    std::find_first_of(
+                        data.data(), data.data() + length, needles.data(),
+                        needles.data() + needles_count));
+
+                data[position] = static_cast<T>(1);
+            }
+        }
+    }
+
+    template<typename Kernels>
+    auto testSimdFindClass() -> void
+    {
+        auto const data = createRandomArrayOfInts<u8>(MaxTestLength * 4);
+
+        for (size_t code = 0; code != CharClass::number_of_chars; code += 7) {
+            CharClass char_class{};
+            char_class.add(code);
+            char_class.add(255 - code);
+
+            auto contains = [&char_class](u8 chr) { return char_class.contains(chr); };
+
+            for (size_t length = 0; length != data.size(); length += 13) {
+                ASSERT_EQUAL(
+                    Kernels::findClass(data.data(), length, char_class),
+                    std::find_if(data.data(), data.data() + length, contains));
+            }
+        }
+    }
+
+    template<typename Kernels>
+    auto testSimdMultiNeedleKernels() -> void
+    {
+        if (amd64::getSimdLevel() < Kernels::level) {
+            return;
+        }
+
+        for (size_t needles_count : { 0UL, 1UL, 5UL, 9UL, 16UL, 17UL, 40UL }) {
+            testSimdFindAnyOf<Kernels, u8>(needles_count);
+            testSimdFindAnyOf<Kernels, char16_t>(needles_count);
+            testSimdFindAnyOf<Kernels, u32>(needles_count);
+        }
+
+        for (size_t needle_length : { 1UL, 2UL, 3UL, 7UL, 20UL }) {
+            testSimdSearch<Kernels, char>(needle_length);
+            testSimdSearch<Kernels, u16>(needle_length);
+            testSimdSearch<Kernels, u32>(needle_length);
+            testSimdSearch<Kernels, u64>(needle_length);
+        }
+
+        if constexpr (requires { Kernels::findClass(nullptr, 0, CharClass{}); }) {
+            testSimdFindClass<Kernels>();
+        }
+    }
+
+    template<typename Kernels>
+    auto testSimdKernels() -> void
+    {
+        if (amd64::getSimdLevel() < Kernels::level) {
+            return;
+        }
+
+        testSimdFill<Kernels, u8>(0xAC);
+        testSimdFill<Kernels, u16>(0xABCD);
+        testSimdFill<Kernels, u32>(0x1234'ABCD);
+        testSimdFill<Kernels, u64>(0x1234'5678'9ABC'DEF0);
+        testSimdFill<Kernels, f64>(0.5);
+
+        testSimdCopy<Kernels>();
+
+        testSimdFind<Kernels, u8>();
+        testSimdFind<Kernels, u16>();
+        testSimdFind<Kernels, u32>();
+        testSimdFind<Kernels, u64>();
+
+        testSimdMismatch<Kernels>();
+
+        testSimdBitwiseApply<Kernels, BitwiseOperation::AND>();
+        testSimdBitwiseApply<Kernels, BitwiseOperation::OR>();
+        testSimdBitwiseApply<Kernels, BitwiseOperation::XOR>();
+        testSimdBitwiseApply<Kernels, BitwiseOperation::ANDNOT>();
+    }
+
+    auto testSimdCopyOfOverlappingRanges() -> void
+    {
+        std::array<u32, 64> data{};
+        std::iota(data.begin(), data.end(), 0);
+
+        copy(data.data(), data.data() + 1, data.size() - 1);
+
+        ASSERT_EQUAL(data.front(), 1U);
+        ASSERT_EQUAL(data[data.size() - 2], 63U);
+    }
+#endif /* CERBLIB_SIMD */
+
+    auto testSimd() -> int
+    {
+#if CERBLIB_SIMD
+        testSimdKernels<Sse2Kernels>();
+        testSimdKernels<Avx2Kernels>();
+        testSimdKernels<Avx512Kernels>();
+
+        testSimdMultiNeedleKernels<Sse2Kernels>();
+        testSimdMultiNeedleKernels<Sse42Kernels>();
+        testSimdMultiNeedleKernels<Avx2Kernels>();
+        testSimdMultiNeedleKernels<Avx512Kernels>();
+        testSimdCopyOfOverlappingRanges();
+#endif /* CERBLIB_SIMD */
+        return 0;
+    }
+}// namespace cerb::debug
@@ -1,5 +1,6 @@
 #include <cerberus/debug/debug.hpp>
 #include <cerberus/range.hpp>
+#include <cerberus/searcher.hpp>
 #include <cerberus/string_view.hpp>
 #include <string>
 
@@ -125,6 +126,63 @@ namespace cerb::debug
         return true;
     }
 
+    auto testStringViewThreeWayComparison() -> void
+    {
+        constexpr size_t max_length = 80;
+
+        std::string lhs(max_length, 'a');
+        std::string rhs(max_length, 'a');
+
+        for (size_t length = 0; length != max_length; ++length) {
+            auto lhs_view = std::string_view{ lhs.data(), length };
+
+            for (size_t position = 0; position < length; ++position) {
+                rhs[position] = position % 2 == 0 ? 'b' : 'A';
+                auto rhs_view = std::string_view{ rhs.data(), length };
+                auto cerb_lhs_view = cerb::string_view{ lhs_view };
+                auto cerb_rhs_view = cerb::string_view{ rhs_view };
+
+                ASSERT_TRUE((cerb_lhs_view <=> rhs_view) == (lhs_view <=> rhs_view));
+                ASSERT_TRUE((cerb_rhs_view <=> lhs_view) == (rhs_view <=> lhs_view));
+                ASSERT_FALSE(cerb_lhs_view == rhs_view);
+
+                rhs[position] = 'a';
+            }
+
+            auto cerb_lhs_view = cerb::string_view{ lhs_view };
+            auto equal_view = std::string_view(rhs.data(), length);
+            auto longer_view = std::string_view(rhs.data(), length + 1);
+
+            ASSERT_TRUE(cerb_lhs_view == equal_view);
+            ASSERT_TRUE(cerb_lhs_view < longer_view);
+            ASSERT_FALSE(cerb_lhs_view == longer_view);
+        }
+    }
+
+    auto testStringViewSubstringSearch() -> void
+    {
+        constexpr std::string_view text = "abcabdabcabcdabcd abcaab abc!";
+        constexpr std::array<std::string_view, 8> needles = {
+            "", "a", "ab", "abc", "abcd", "abc!", "xyz", "abcabdabcabcdabcd abcaab abc!?"
+        };
+
+        cerb::string_view cerb_text = text;
+
+        for (auto needle : needles) {
+            Searcher<char> searcher{ needle };
+
+            ASSERT_EQUAL(cerb_text.rfind(cerb::string_view{ needle }), text.rfind(needle));
+            ASSERT_EQUAL(searcher.rfind(text), text.rfind(needle));
+
+            for (size_t position = 0; position <= text.size() + 1; ++position) {
+                ASSERT_EQUAL(
+                    cerb_text.find(cerb::string_view{ needle }, position),
+                    text.find(needle, position));
+                ASSERT_EQUAL(searcher.find(text, position), text.find(needle, position));
+            }
+        }
+    }
+
     auto testStringView() -> int
     {
         CERBERUS_TEST(testEqualStringViewComparisonWithStdStringView());
@@ -135,6 +193,9 @@ namespace cerb::debug
         CERBERUS_TEST(testNotEqualStringViewComparisonWithStdStringView());
         CERBERUS_TEST(testStringViewFind());
         CERBERUS_TEST(testStringViewRfind());
+        CERBERUS_TEST(testStringViewContainsAt());
+        testStringViewThreeWayComparison();
+        testStringViewSubstringSearch();
 
         return 0;
     }
@@ -0,0 +1,92 @@
+#ifndef CERBERUS_ARENA_HPP
+#define CERBERUS_ARENA_HPP
+
+#include <cerberus/number.hpp>
+#include <cerberus/pair.hpp>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace cerb
+{
+    // Owner of objects of any types, which are destroyed all at once with the arena. Memory comes
+    // from a monotonic buffer, so allocation is mostly a pointer bump. Objects may be created from
+    // several threads and from constructors of other objects in the same arena.
+    class Arena
+    {
+        using destructor_t = void (*)(void *);
+
+    public:
+        constexpr static size_t initial_buffer_size = 4096;
+
+        [[nodiscard]] auto size() const -> size_t
+        {
+            std::scoped_lock lock{ arena_mutex };
+            return number_of_objects;
+        }
+
+        template<typename T, typename... Ts>
+        auto create(Ts &&...args) -> T *
+        {
+            auto *memory = allocate(sizeof(T), alignof(T));
+            auto *object = new (memory) T(std::forward<Ts>(args)...);
+
+            std::scoped_lock lock{ arena_mutex };
+            ++number_of_objects;
+
+            if constexpr (not std::is_trivially_destructible_v<T>) {
+                destructors.emplace_back(object, [](void *pointer) {
+                    static_cast<T *>(pointer)->~T();
+                });
+            }
+
+            return object;
+        }
+
+        // destroys all objects and returns memory of the arena, objects must not be used after it
+        auto clear() -> void
+        {
+            std::scoped_lock lock{ arena_mutex };
+            destroyObjects();
+
+            destructors.clear();
+            destructors.shrink_to_fit();
+            memory_resource.release();
+            number_of_objects = 0;
+        }
+
+        Arena() = default;
+
+        Arena(Arena const &) = delete;
+        Arena(Arena &&) noexcept = delete;
+
+        ~Arena()
+        {
+            destroyObjects();
+        }
+
+        auto operator=(Arena const &) -> Arena & = delete;
+        auto operator=(Arena &&) noexcept -> Arena & = delete;
+
+    private:
+        auto destroyObjects() -> void
+        {
+            for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+                it->second(it->first);
+            }
+        }
+
+        auto allocate(size_t size, size_t alignment) -> void *
+        {
+            std::scoped_lock lock{ arena_mutex };
+            return memory_resource.allocate(size, alignment);
+        }
+
+        std::pmr::monotonic_buffer_resource memory_resource{ initial_buffer_size };
+        std::vector<Pair<void *, destructor_t>> destructors{};
+        size_t number_of_objects{};
+        mutable std::mutex arena_mutex{};
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_ARENA_HPP */
@@ -74,6 +74,7 @@ namespace cerb::bit
 
             case ValueOfBit::ZERO:
                 result &= ~(*array_iterator)[index];
+                break;
 
             default:
                 break;
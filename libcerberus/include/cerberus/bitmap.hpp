@@ -4,13 +4,187 @@
 #include <cerberus/bit.hpp>
 #include <cerberus/bit_manipulation.hpp>
 #include <cerberus/memory.hpp>
+#include <array>
 #include <vector>
 
 namespace cerb
 {
-    class Bitmap
+    namespace private_
     {
+        // Words of a bitmap. Up to InlineWords words are kept inside the object, larger bitmaps
+        // are moved to the heap. Inline words past the size are always zero.
+        template<size_t InlineWords>
+        class BitmapStorage
+        {
+        public:
+            CERBLIB_DECL auto size() const -> size_t
+            {
+                return number_of_words;
+            }
+
+            CERBLIB_DECL auto empty() const -> bool
+            {
+                return number_of_words == 0;
+            }
+
+            CERBLIB_DECL auto isInline() const -> bool
+            {
+                return number_of_words <= InlineWords;
+            }
+
+            CERBLIB_DECL auto data() -> size_t *
+            {
+                return isInline() ? inline_words.data() : heap_words.data();
+            }
+
+            CERBLIB_DECL auto data() const -> size_t const *
+            {
+                return isInline() ? inline_words.data() : heap_words.data();
+            }
+
+            CERBLIB_DECL auto begin() -> size_t *
+            {
+                return data();
+            }
+
+            CERBLIB_DECL auto end() -> size_t *
+            {
+                return data() + number_of_words;
+            }
+
+            CERBLIB_DECL auto operator[](size_t index) -> size_t &
+            {
+                return data()[index];
+            }
+
+            CERBLIB_DECL auto operator[](size_t index) const -> size_t
+            {
+                return data()[index];
+            }
+
+            // new words are filled with zeros
+            constexpr auto resize(size_t new_size) -> void
+            {
+                if (isInline()) {
+                    resizeFromInline(new_size);
+                } else {
+                    resizeFromHeap(new_size);
+                }
+
+                number_of_words = new_size;
+            }
+
+        private:
+            constexpr auto resizeFromInline(size_t new_size) -> void
+            {
+                if (new_size <= InlineWords) {
+                    std::fill(inline_words.begin() + new_size, inline_words.end(), 0);
+                    return;
+                }
+
+                heap_words.assign(inline_words.begin(), inline_words.begin() + number_of_words);
+                heap_words.resize(new_size, 0);
+                inline_words.fill(0);
+            }
+
+            constexpr auto resizeFromHeap(size_t new_size) -> void
+            {
+                if (new_size > InlineWords) {
+                    heap_words.resize(new_size, 0);
+                    return;
+                }
+
+                std::copy_n(heap_words.begin(), new_size, inline_words.begin());
+                heap_words.clear();
+            }
+
+            std::array<size_t, InlineWords> inline_words{};
+            std::vector<size_t> heap_words{};
+            size_t number_of_words{};
+        };
+    }// namespace private_
+
+    // Bitmap, which keeps up to InlineWords words without heap allocations
+    template<size_t InlineWords>
+    class BasicBitmap
+    {
+        using storage_t = private_::BitmapStorage<InlineWords>;
+
+        constexpr static size_t word_bits = bitsizeof(size_t);
+
     public:
+        class SetBitIterator
+        {
+        public:
+            using value_type = size_t;
+            using difference_type = ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            CERBLIB_DECL auto operator*() const -> size_t
+            {
+                return word_index * word_bits + bit::scanForward<1>(current_word);
+            }
+
+            constexpr auto operator++() -> SetBitIterator &
+            {
+                current_word &= current_word - 1;
+                skipEmptyWords();
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> SetBitIterator
+            {
+                auto old = *this;
+                ++(*this);
+                return old;
+            }
+
+            CERBLIB_DECL auto operator==(SetBitIterator const &other) const -> bool
+            {
+                return logicalAnd(
+                    word_index == other.word_index, current_word == other.current_word);
+            }
+
+            SetBitIterator() = default;
+
+            constexpr SetBitIterator(size_t const *words, size_t number_of_words, size_t index)
+              : storage(words), storage_size(number_of_words), word_index(index)
+            {
+                if (word_index != storage_size) {
+                    current_word = storage[word_index];
+                    skipEmptyWords();
+                }
+            }
+
+        private:
+            constexpr auto skipEmptyWords() -> void
+            {
+                while (current_word == 0 && ++word_index != storage_size) {
+                    current_word = storage[word_index];
+                }
+            }
+
+            size_t const *storage{};
+            size_t storage_size{};
+            size_t word_index{};
+            size_t current_word{};
+        };
+
+        struct SetBits
+        {
+            CERBLIB_DECL auto begin() const -> SetBitIterator
+            {
+                return { storage.data(), storage.size(), 0 };
+            }
+
+            CERBLIB_DECL auto end() const -> SetBitIterator
+            {
+                return { storage.data(), storage.size(), storage.size() };
+            }
+
+            storage_t const &storage;
+        };
+
         constexpr auto clear() -> void
         {
             fill(storage, 0);
@@ -20,18 +194,34 @@ namespace cerb
         constexpr auto set(size_t index) -> void
         {
             checkStorageCapacity(index);
-            bit::set<BitValue, size_t>(storage.begin(), index);
+            bit::set<BitValue, size_t>(storage.data(), index);
         }
 
+        // sets bits in range [from, to)
         template<u16 BitValue>
         constexpr auto multiSet(size_t from, size_t to) -> void
         {
             checkStorageCapacity(to);
 
-            CERBLIB_UNROLL_N(4)
-            for (; from != to; ++from) {
-                bit::set<BitValue, size_t>(storage.begin(), from);
+            if (from >= to) {
+                return;
             }
+
+            auto first_word = from / word_bits;
+            auto last_word = (to - 1) / word_bits;
+            auto first_mask = ~static_cast<size_t>(0) << (from % word_bits);
+            auto last_mask = ~static_cast<size_t>(0) >> (word_bits - 1 - (to - 1) % word_bits);
+
+            if (first_word == last_word) {
+                setByMask<BitValue>(first_word, first_mask & last_mask);
+                return;
+            }
+
+            constexpr size_t filler = BitValue == 0 ? 0 : std::numeric_limits<size_t>::max();
+
+            setByMask<BitValue>(first_word, first_mask);
+            fill(storage.data() + first_word + 1, filler, last_word - first_word - 1);
+            setByMask<BitValue>(last_word, last_mask);
         }
 
         CERBLIB_DECL auto at(size_t index) const -> bool
@@ -48,6 +238,22 @@ namespace cerb
             return storage.empty();
         }
 
+        CERBLIB_DECL auto isInline() const -> bool
+        {
+            return storage.isInline();
+        }
+
+        CERBLIB_DECL auto popCount() const -> size_t
+        {
+            return cerb::popCount(storage.data(), storage.size());
+        }
+
+        // indexes of the set bits in ascending order
+        CERBLIB_DECL auto setBits() const -> SetBits
+        {
+            return { storage };
+        }
+
         constexpr auto reverseValues() -> void
         {
             for (size_t &chunk : storage) {
@@ -55,12 +261,84 @@ namespace cerb
             }
         }
 
-        Bitmap() = default;
+        constexpr auto operator&=(BasicBitmap const &other) -> BasicBitmap &
+        {
+            applyBitwise<BitwiseOperation::AND>(other);
+            return *this;
+        }
+
+        constexpr auto operator|=(BasicBitmap const &other) -> BasicBitmap &
+        {
+            applyBitwise<BitwiseOperation::OR>(other);
+            return *this;
+        }
+
+        constexpr auto operator^=(BasicBitmap const &other) -> BasicBitmap &
+        {
+            applyBitwise<BitwiseOperation::XOR>(other);
+            return *this;
+        }
+
+        // removes bits, which are set in other
+        constexpr auto andNot(BasicBitmap const &other) -> BasicBitmap &
+        {
+            applyBitwise<BitwiseOperation::ANDNOT>(other);
+            return *this;
+        }
+
+        CERBLIB_DECL friend auto operator&(BasicBitmap lhs, BasicBitmap const &rhs) -> BasicBitmap
+        {
+            return lhs &= rhs;
+        }
+
+        CERBLIB_DECL friend auto operator|(BasicBitmap lhs, BasicBitmap const &rhs) -> BasicBitmap
+        {
+            return lhs |= rhs;
+        }
+
+        CERBLIB_DECL friend auto operator^(BasicBitmap lhs, BasicBitmap const &rhs) -> BasicBitmap
+        {
+            return lhs ^= rhs;
+        }
+
+        BasicBitmap() = default;
 
     private:
+        template<u16 BitValue>
+        constexpr auto setByMask(size_t word_index, size_t mask) -> void
+        {
+            if constexpr (BitValue == 0) {
+                storage[word_index] &= ~mask;
+            } else {
+                storage[word_index] |= mask;
+            }
+        }
+
+        // bitmaps may have different sizes, missing words are treated as zeros
+        template<BitwiseOperation Operation>
+        constexpr auto applyBitwise(BasicBitmap const &other) -> void
+        {
+            constexpr bool can_set_new_bits =
+                Operation == BitwiseOperation::OR || Operation == BitwiseOperation::XOR;
+
+            if constexpr (can_set_new_bits) {
+                if (storage.size() < other.storage.size()) {
+                    storage.resize(other.storage.size());
+                }
+            }
+
+            auto common_size = min(storage.size(), other.storage.size());
+            bitwiseApply<Operation>(storage.data(), other.storage.data(), common_size);
+
+            if constexpr (Operation == BitwiseOperation::AND) {
+                auto rest_size = storage.size() - common_size;
+                fill(storage.data() + common_size, static_cast<size_t>(0), rest_size);
+            }
+        }
+
         CERBLIB_DECL auto indexOutOfCapacity(size_t index) const -> bool
         {
-            auto storage_index = index / bitsizeof(size_t);
+            auto storage_index = index / word_bits;
             return storage_index >= storage.size();
         }
 
@@ -68,13 +346,39 @@ namespace cerb
         {
             constexpr size_t additional_blocks = 2;
 
-            if (index >= storage.size() * bitsizeof(size_t)) {
-                storage.resize(index / bitsizeof(size_t) + additional_blocks, 0);
+            if (index >= storage.size() * word_bits) {
+                auto required_words = index / word_bits + 1;
+                auto new_size = required_words + additional_blocks - 1;
+
+                if (required_words <= InlineWords) {
+                    new_size = min(new_size, InlineWords);
+                }
+
+                storage.resize(new_size);
             }
         }
 
-        std::vector<size_t> storage{};
+        storage_t storage{};
     };
+
+    using Bitmap = BasicBitmap<256 / bitsizeof(size_t)>;
+
+    // first 256 bits as a class of bytes, build it once to search bytes with the simd kernels
+    template<size_t InlineWords>
+    CERBLIB_DECL auto toCharClass(BasicBitmap<InlineWords> const &bitmap) -> CharClass
+    {
+        return CharClass::fromPredicate([&bitmap](size_t code) { return bitmap.at(code); });
+    }
+
+    template<std::integral T, size_t InlineWords>
+    CERBLIB_DECL auto
+        findClass(T const *location, size_t limit, BasicBitmap<InlineWords> const &char_class)
+        -> T const *
+    {
+        return std::find_if(location, location + limit, [&char_class](T chr) {
+            return char_class.at(static_cast<size_t>(static_cast<std::make_unsigned_t<T>>(chr)));
+        });
+    }
 }// namespace cerb
 
 #endif /* CERBERUS_BITMAP_HPP */
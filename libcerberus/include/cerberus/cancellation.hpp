@@ -0,0 +1,123 @@
+#ifndef CERBERUS_CANCELLATION_HPP
+#define CERBERUS_CANCELLATION_HPP
+
+#include <cerberus/exception.hpp>
+#include <cerberus/number.hpp>
+#include <chrono>
+#include <stop_token>
+
+namespace cerb
+{
+    CERBERUS_EXCEPTION(OperationCancelledError, CerberusException);
+
+    class CancellationToken
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        [[nodiscard]] auto getStopToken() const -> std::stop_token const &
+        {
+            return stop_token;
+        }
+
+        [[nodiscard]] auto getDeadline() const -> clock::time_point
+        {
+            return deadline;
+        }
+
+        [[nodiscard]] auto isStopRequested() const -> bool
+        {
+            return stop_token.stop_requested();
+        }
+
+        [[nodiscard]] auto isDeadlineExceeded() const -> bool
+        {
+            return deadline != clock::time_point::max() && clock::now() >= deadline;
+        }
+
+        [[nodiscard]] auto isCancelled() const -> bool
+        {
+            return logicalOr(isStopRequested(), isDeadlineExceeded());
+        }
+
+        auto throwIfCancelled() const -> void
+        {
+            if (isStopRequested()) {
+                throw OperationCancelledError("Operation has been cancelled!");
+            }
+
+            if (isDeadlineExceeded()) {
+                throw OperationCancelledError("Operation deadline has been exceeded!");
+            }
+        }
+
+        [[nodiscard]] auto withDeadline(clock::time_point new_deadline) const -> CancellationToken
+        {
+            return CancellationToken{ stop_token, min(deadline, new_deadline) };
+        }
+
+        [[nodiscard]] auto withTimeout(clock::duration timeout) const -> CancellationToken
+        {
+            return withDeadline(clock::now() + timeout);
+        }
+
+        CancellationToken() = default;
+
+        explicit CancellationToken(
+            std::stop_token token, clock::time_point time_limit = clock::time_point::max())
+          : stop_token(std::move(token)), deadline(time_limit)
+        {}
+
+        explicit CancellationToken(clock::time_point time_limit) : deadline(time_limit)
+        {}
+
+    private:
+        std::stop_token stop_token{};
+        clock::time_point deadline{ clock::time_point::max() };
+    };
+
+    // Checking a token requires a clock read, so scanning loops check it only once per
+    // check_interval processed characters.
+    struct CancellationCheckpoint
+    {
+        constexpr static size_t default_check_interval = 4096;
+
+        constexpr auto tick() -> void
+        {
+            if (token != nullptr && --countdown == 0) {
+                countdown = check_interval;
+                token->throwIfCancelled();
+            }
+        }
+
+        constexpr auto tick(size_t processed_chars) -> void
+        {
+            if (token == nullptr) {
+                return;
+            }
+
+            if (processed_chars < countdown) {
+                countdown -= processed_chars;
+            } else {
+                countdown = check_interval;
+                token->throwIfCancelled();
+            }
+        }
+
+        CancellationCheckpoint() = default;
+
+        explicit CancellationCheckpoint(
+            CancellationToken const &cancellation_token,
+            size_t interval = default_check_interval)
+          : token(&cancellation_token), check_interval(max<size_t>(1, interval)),
+            countdown(check_interval)
+        {}
+
+    private:
+        CancellationToken const *token{ nullptr };
+        size_t check_interval{ default_check_interval };
+        size_t countdown{ default_check_interval };
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_CANCELLATION_HPP */
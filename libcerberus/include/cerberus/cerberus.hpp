@@ -52,6 +52,22 @@
 #    endif
 #endif /* CERBLIB_AMD64 */
 
+#ifndef CERBLIB_SIMD
+#    if CERBLIB_AMD64 && (defined(__GNUC__) || defined(__clang__))
+#        define CERBLIB_SIMD true
+#    else
+#        define CERBLIB_SIMD false
+#    endif
+#endif /* CERBLIB_SIMD */
+
+#ifndef CERBLIB_TARGET
+#    if defined(__GNUC__) || defined(__clang__)
+#        define CERBLIB_TARGET(isa) __attribute__((target(isa)))
+#    else
+#        define CERBLIB_TARGET(isa)
+#    endif
+#endif /* CERBLIB_TARGET */
+
 #ifndef CERBLIB_64BIT
 #    if INTPTR_MAX == INT32_MAX
 #        define CERBLIB_64BIT false
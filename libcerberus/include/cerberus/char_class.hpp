@@ -0,0 +1,94 @@
+#ifndef CERBERUS_CHAR_CLASS_HPP
+#define CERBERUS_CHAR_CLASS_HPP
+
+#include <cerberus/number.hpp>
+#include <cerberus/type.hpp>
+#include <concepts>
+
+namespace cerb
+{
+    // Set of 256 byte values. Bit n of row[c & 0xF] tells whether (n << 4) | (c & 0xF) is in
+    // the set, so that a set can be checked with two byte shuffles. Chars wider than a byte
+    // never belong to the set.
+    struct CharClass
+    {
+        constexpr static size_t number_of_rows = 16;
+        constexpr static size_t number_of_chars = 256;
+
+        using table_t = std::array<u8, number_of_rows>;
+
+        CERBLIB_DECL auto getLowTable() const -> table_t const &
+        {
+            return low_table;
+        }
+
+        CERBLIB_DECL auto getHighTable() const -> table_t const &
+        {
+            return high_table;
+        }
+
+        template<std::integral Int>
+        CERBLIB_DECL auto contains(Int chr) const -> bool
+        {
+            auto code = static_cast<size_t>(static_cast<std::make_unsigned_t<Int>>(chr));
+
+            if (code >= number_of_chars) {
+                return false;
+            }
+
+            auto row = static_cast<size_t>(getTable(code)[code % number_of_rows]);
+            return ((row >> bitOfChar(code)) & 1U) != 0;
+        }
+
+        template<std::integral Int>
+        constexpr auto add(Int chr) -> void
+        {
+            auto code = static_cast<size_t>(static_cast<std::make_unsigned_t<Int>>(chr));
+
+            if (code < number_of_chars) {
+                auto &table = code < number_of_chars / 2 ? low_table : high_table;
+                table[code % number_of_rows] |= static_cast<u8>(1U << bitOfChar(code));
+            }
+        }
+
+        template<std::predicate<size_t> Predicate>
+        CERBLIB_DECL static auto fromPredicate(Predicate &&predicate) -> CharClass
+        {
+            CharClass char_class{};
+
+            for (size_t code = 0; code != number_of_chars; ++code) {
+                if (predicate(code)) {
+                    char_class.add(code);
+                }
+            }
+
+            return char_class;
+        }
+
+        CharClass() = default;
+
+        template<Iterable T>
+        constexpr explicit CharClass(T const &chars)
+        {
+            for (auto chr : chars) {
+                add(chr);
+            }
+        }
+
+    private:
+        CERBLIB_DECL static auto bitOfChar(size_t code) -> size_t
+        {
+            return (code / number_of_rows) % bitsizeof(u8);
+        }
+
+        CERBLIB_DECL auto getTable(size_t code) const -> table_t const &
+        {
+            return code < number_of_chars / 2 ? low_table : high_table;
+        }
+
+        table_t low_table{};
+        table_t high_table{};
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_CHAR_CLASS_HPP */
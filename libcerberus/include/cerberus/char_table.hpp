@@ -0,0 +1,118 @@
+#ifndef CERBERUS_CHAR_TABLE_HPP
+#define CERBERUS_CHAR_TABLE_HPP
+
+#include <cerberus/number.hpp>
+#include <cerberus/pair.hpp>
+#include <array>
+#include <stdexcept>
+
+namespace cerb
+{
+    // Table from chars to values, lookup of which is a single load for byte-wide chars. Wider
+    // chars are split into blocks of 256 chars by the high byte of their code, blocks without
+    // explicit values share the block of default values. Codes past 0xFFFF always map to the
+    // default value.
+    template<CharacterLiteral CharT, typename Value, size_t Blocks = 2>
+    class CharTable
+    {
+        constexpr static size_t block_size = 256;
+        constexpr static size_t max_code = block_size * block_size - 1;
+        constexpr static bool is_flat = sizeof(CharT) == sizeof(u8);
+        constexpr static size_t number_of_blocks = is_flat ? 1 : Blocks;
+
+        static_assert(Blocks >= 2 && Blocks <= block_size);
+
+        using block_t = std::array<Value, block_size>;
+
+    public:
+        using value_type = Value;
+
+        CERBLIB_DECL auto getDefaultValue() const -> Value const &
+        {
+            return default_value;
+        }
+
+        CERBLIB_DECL auto operator[](CharT chr) const -> Value
+        {
+            auto code = asCode(chr);
+
+            if constexpr (is_flat) {
+                return blocks[0][code];
+            } else {
+                if (code > max_code) {
+                    return default_value;
+                }
+
+                return blocks[block_of_high_byte[code / block_size]][code % block_size];
+            }
+        }
+
+        constexpr auto set(CharT chr, Value const &value) -> void
+        {
+            auto code = asCode(chr);
+
+            if constexpr (is_flat) {
+                blocks[0][code] = value;
+            } else {
+                if (code > max_code) {
+                    throw std::out_of_range("Cerberus char table supports only 16-bit codes!");
+                }
+
+                getWritableBlock(code / block_size)[code % block_size] = value;
+            }
+        }
+
+        // sets values for chars in range [first, last]
+        constexpr auto setRange(CharT first, CharT last, Value const &value) -> void
+        {
+            for (auto code = asCode(first); code <= asCode(last); ++code) {
+                set(static_cast<CharT>(code), value);
+            }
+        }
+
+        CharTable() = default;
+
+        constexpr explicit CharTable(Value const &default_value_for_chars)
+          : default_value(default_value_for_chars)
+        {
+            blocks[0].fill(default_value);
+        }
+
+        constexpr CharTable(
+            std::initializer_list<Pair<CharT, Value>> const &values,
+            Value const &default_value_for_chars = {})
+          : CharTable(default_value_for_chars)
+        {
+            for (auto const &value : values) {
+                set(value.first, value.second);
+            }
+        }
+
+    private:
+        CERBLIB_DECL static auto asCode(CharT chr) -> size_t
+        {
+            return static_cast<size_t>(static_cast<std::make_unsigned_t<CharT>>(chr));
+        }
+
+        constexpr auto getWritableBlock(size_t high_byte) -> block_t &
+        {
+            if (block_of_high_byte[high_byte] == 0) {
+                if (used_blocks == number_of_blocks) {
+                    throw std::out_of_range("Cerberus char table is full!");
+                }
+
+                blocks[used_blocks].fill(default_value);
+                block_of_high_byte[high_byte] = static_cast<u8>(used_blocks++);
+            }
+
+            return blocks[block_of_high_byte[high_byte]];
+        }
+
+        std::array<block_t, number_of_blocks> blocks{};
+        std::array<u8, is_flat ? 0 : block_size> block_of_high_byte{};
+        size_t used_blocks{ 1 };
+        Value default_value{};
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_CHAR_TABLE_HPP */
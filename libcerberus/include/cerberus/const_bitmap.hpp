@@ -76,42 +76,183 @@ namespace cerb
 
         template<bit::ValueOfBit... BitValues>
         CERBLIB_DECL auto find() const -> size_t
+        {
+            return findNext<BitValues...>(0);
+        }
+
+        // index of the first bit at or after from, which has the given value on every axis
+        template<bit::ValueOfBit... BitValues>
+        CERBLIB_DECL auto findNext(size_t from) const -> size_t
         {
             static_assert(AxisN == sizeof...(BitValues));
 
-            size_t index = 0;
+            if (from >= BitN) {
+                return npos;
+            }
+
+            auto index = from / word_bits;
+            auto suitable_bits =
+                getSuitableBits<BitValues...>(index) & (max_word << (from % word_bits));
 
-            for (; index != storage.size(); ++index) {
-                auto suitable_bits = getSuitableBits<BitValues...>(index);
+            if (suitable_bits == 0) {
+                index = findSuitableWord<BitValues...>(index + 1);
 
-                if (suitable_bits != 0) {
-                    return calculateBitPosition(index, suitable_bits);
+                if (index == length_of_axis) {
+                    return npos;
                 }
+
+                suitable_bits = getSuitableBits<BitValues...>(index);
             }
 
-            return npos;
+            return calculateBitPosition(index, suitable_bits);
+        }
+
+        template<bit::ValueOfBit... BitValues>
+        class MatchIterator
+        {
+        public:
+            using value_type = size_t;
+            using difference_type = ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            CERBLIB_DECL auto operator*() const -> size_t
+            {
+                return calculateBitPosition(word_index, current_word);
+            }
+
+            constexpr auto operator++() -> MatchIterator &
+            {
+                current_word &= current_word - 1;
+
+                if (current_word == 0) {
+                    loadWord(bitmap->template findSuitableWord<BitValues...>(word_index + 1));
+                }
+
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> MatchIterator
+            {
+                auto old = *this;
+                ++(*this);
+                return old;
+            }
+
+            CERBLIB_DECL auto operator==(MatchIterator const &other) const -> bool
+            {
+                return logicalAnd(
+                    word_index == other.word_index, current_word == other.current_word);
+            }
+
+            MatchIterator() = default;
+
+            constexpr MatchIterator(ConstBitmap const *bitmap_to_iterate, size_t index)
+              : bitmap(bitmap_to_iterate)
+            {
+                loadWord(index);
+            }
+
+        private:
+            constexpr auto loadWord(size_t index) -> void
+            {
+                word_index = index;
+                current_word = word_index == length_of_axis
+                                   ? 0
+                                   : bitmap->template getSuitableBits<BitValues...>(word_index);
+            }
+
+            ConstBitmap const *bitmap{};
+            size_t word_index{};
+            size_t current_word{};
+        };
+
+        template<bit::ValueOfBit... BitValues>
+        struct Matches
+        {
+            CERBLIB_DECL auto begin() const -> MatchIterator<BitValues...>
+            {
+                return { &bitmap, bitmap.template findSuitableWord<BitValues...>(0) };
+            }
+
+            CERBLIB_DECL auto end() const -> MatchIterator<BitValues...>
+            {
+                return { &bitmap, length_of_axis };
+            }
+
+            ConstBitmap const &bitmap;
+        };
+
+        // indexes of the bits, which have the given value on every axis, in ascending order
+        template<bit::ValueOfBit... BitValues>
+        CERBLIB_DECL auto matches() const -> Matches<BitValues...>
+        {
+            static_assert(AxisN == sizeof...(BitValues));
+            return { *this };
         }
 
         ConstBitmap() = default;
 
     private:
+        constexpr static size_t word_bits = bitsizeof(size_t);
+        constexpr static size_t max_word = std::numeric_limits<size_t>::max();
+
+        // bits past BitN are never reported, even if they match
+        constexpr static size_t last_word_mask =
+            BitN % word_bits == 0 ? max_word : max_word >> (word_bits - BitN % word_bits);
+
         template<bit::ValueOfBit... BitValues>
         CERBLIB_DECL auto getSuitableBits(size_t index) const -> size_t
         {
-            return bit::applyMaskOnArray<size_t, typename storage_t::const_iterator, BitValues...>(
-                index, storage.begin());
+            auto suitable_bits =
+                bit::applyMaskOnArray<size_t, typename storage_t::const_iterator, BitValues...>(
+                    index, storage.begin());
+
+            return index == length_of_axis - 1 ? suitable_bits & last_word_mask : suitable_bits;
         }
 
-        CERBLIB_DECL auto calculateBitPosition(size_t index, size_t suitable_bits) const -> size_t
+        // index of the first word at or after from, which has suitable bits, or length_of_axis
+        template<bit::ValueOfBit... BitValues>
+        CERBLIB_DECL auto findSuitableWord(size_t from) const -> size_t
+        {
+            auto index = findMaskedWord<BitValues...>(storage.data(), from);
+
+            if (index == length_of_axis - 1 && getSuitableBits<BitValues...>(index) == 0) {
+                return length_of_axis;
+            }
+
+            return index;
+        }
+
+        CERBLIB_DECL static auto calculateBitPosition(size_t index, size_t suitable_bits)
+            -> size_t
         {
             auto index_of_bit_in_number = bit::scanForward<1, size_t>(suitable_bits);
-            auto bit_index = index * bitsizeof(size_t) + index_of_bit_in_number;
-            return bit_index < BitN ? bit_index : npos;
+            return index * word_bits + index_of_bit_in_number;
         }
 
         storage_t storage{};
     };
 
+    // first 256 bits as a class of bytes, build it once to search bytes with the simd kernels
+    template<size_t BitN>
+    CERBLIB_DECL auto toCharClass(ConstBitmap<1, BitN> const &bitmap) -> CharClass
+    {
+        return CharClass::fromPredicate([&bitmap](size_t code) {
+            return code < BitN && bitmap.template at<0>(code);
+        });
+    }
+
+    template<std::integral T, size_t BitN>
+    CERBLIB_DECL auto
+        findClass(T const *location, size_t limit, ConstBitmap<1, BitN> const &char_class)
+            -> T const *
+    {
+        return std::find_if(location, location + limit, [&char_class](T chr) {
+            auto code = static_cast<size_t>(static_cast<std::make_unsigned_t<T>>(chr));
+            return code < BitN && char_class.template at<0>(code);
+        });
+    }
+
 }// namespace cerb
 
 #endif /* CERBERUS_CONST_BITMAP_HPP */
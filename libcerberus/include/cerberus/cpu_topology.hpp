@@ -0,0 +1,190 @@
+#ifndef CERBERUS_CPU_TOPOLOGY_HPP
+#define CERBERUS_CPU_TOPOLOGY_HPP
+
+#include <cerberus/cerberus.hpp>
+#include <cerberus/number.hpp>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#    include <pthread.h>
+#    include <sched.h>
+#endif /* __linux__ */
+
+namespace cerb
+{
+    // largest number of cpus linux can be configured with (NR_CPUS with MAXSMP), cpus outside of
+    // it are treated as malformed input
+    constexpr u32 MaxNumberOfCpus = 8192;
+
+    namespace private_
+    {
+        inline auto parseCpuNumber(std::string_view text, u32 &number) -> bool
+        {
+            auto const *text_end = text.data() + text.size();
+            auto [last_char, error] = std::from_chars(text.data(), text_end, number);
+            return error == std::errc{} && last_char == text_end && number < MaxNumberOfCpus;
+        }
+
+        inline auto
+            parseCpuRange(std::string_view range, size_t dash_index, u32 &first, u32 &last)
+                -> bool
+        {
+            if (not parseCpuNumber(range.substr(0, dash_index), first)) {
+                return false;
+            }
+
+            if (not parseCpuNumber(range.substr(dash_index + 1), last)) {
+                return false;
+            }
+
+            return first <= last;
+        }
+
+        inline auto readFirstLine(std::string const &path) -> std::string
+        {
+            std::string line{};
+            std::ifstream file{ path };
+            std::getline(file, line);
+
+            return line;
+        }
+    }// namespace private_
+
+    // parses linux cpu list format, for example: "0-3,8,10-11"
+    inline auto parseCpuList(std::string_view cpu_list) -> std::vector<u32>
+    {
+        using namespace private_;
+
+        std::vector<u32> cpus{};
+
+        while (not cpu_list.empty()) {
+            auto comma_index = min(cpu_list.find(','), cpu_list.size());
+            auto range = cpu_list.substr(0, comma_index);
+            auto dash_index = range.find('-');
+
+            u32 first{};
+            u32 last{};
+
+            if (dash_index == std::string_view::npos) {
+                if (parseCpuNumber(range, first)) {
+                    cpus.push_back(first);
+                }
+            } else if (parseCpuRange(range, dash_index, first, last)) {
+                // last is below MaxNumberOfCpus, so last + 1 does not wrap
+                for (u32 cpu = first; cpu != last + 1; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+
+            cpu_list.remove_prefix(min(comma_index + 1, cpu_list.size()));
+        }
+
+        return cpus;
+    }
+
+    struct CpuTopology
+    {
+        [[nodiscard]] auto numberOfNodes() const -> size_t
+        {
+            return nodes.size();
+        }
+
+        [[nodiscard]] auto getNodeCpus(size_t node) const -> std::vector<u32> const &
+        {
+            return nodes.at(node);
+        }
+
+        [[nodiscard]] auto findNodeOfCpu(u32 cpu) const -> size_t
+        {
+            for (size_t node = 0; node != nodes.size(); ++node) {
+                if (std::ranges::find(nodes[node], cpu) != nodes[node].end()) {
+                    return node;
+                }
+            }
+
+            return 0;
+        }
+
+        static auto load() -> CpuTopology
+        {
+            CpuTopology topology{};
+
+#ifdef __linux__
+            using namespace private_;
+
+            auto const online_nodes =
+                parseCpuList(readFirstLine("/sys/devices/system/node/online"));
+
+            for (u32 node : online_nodes) {
+                auto node_cpus = parseCpuList(readFirstLine(
+                    "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+
+                if (not node_cpus.empty()) {
+                    topology.nodes.push_back(std::move(node_cpus));
+                }
+            }
+#endif /* __linux__ */
+
+            if (topology.nodes.empty()) {
+                topology.nodes.emplace_back(allCpus());
+            }
+
+            return topology;
+        }
+
+        std::vector<std::vector<u32>> nodes{};
+
+    private:
+        static auto allCpus() -> std::vector<u32>
+        {
+            std::vector<u32> cpus(max<size_t>(1, std::thread::hardware_concurrency()));
+
+            for (u32 cpu = 0; cpu != cpus.size(); ++cpu) {
+                cpus[cpu] = cpu;
+            }
+
+            return cpus;
+        }
+    };
+
+    namespace this_thread
+    {
+        // returns false when affinity is not supported or the cpus are not available
+        inline auto setAffinity(std::vector<u32> const &cpus) -> bool
+        {
+#ifdef __linux__
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+
+            for (u32 cpu : cpus) {
+                if (cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &cpu_set);
+                }
+            }
+
+            return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+            return cpus.empty();
+#endif /* __linux__ */
+        }
+
+        inline auto setName(std::string_view name) -> bool
+        {
+#ifdef __linux__
+            // linux limits thread names to 15 characters and a terminator
+            constexpr size_t max_name_length = 15;
+
+            auto truncated_name = std::string(name.substr(0, max_name_length));
+            return pthread_setname_np(pthread_self(), truncated_name.c_str()) == 0;
+#else
+            return name.empty();
+#endif /* __linux__ */
+        }
+    }// namespace this_thread
+}// namespace cerb
+
+#endif /* CERBERUS_CPU_TOPOLOGY_HPP */
@@ -0,0 +1,52 @@
+#ifndef CERBERUS_BENCHMARK_HPP
+#define CERBERUS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <cerberus/cerberus.hpp>
+#include <chrono>
+#include <limits>
+
+namespace cerb::debug
+{
+    template<typename T>
+    auto doNotOptimize(T const &value) -> void
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // best time of one call in nanoseconds, calls are repeated in batches until at least 1 ms
+    // passes, so the clock is not measured together with short calls
+    template<typename Function>
+    auto measure(Function &&function) -> double
+    {
+        using namespace std::chrono_literals;
+        using clock = std::chrono::steady_clock;
+
+        constexpr size_t repetitions = 7;
+        constexpr size_t batch_size = 16;
+
+        auto best_time = std::numeric_limits<double>::max();
+
+        for (size_t repetition = 0; repetition != repetitions; ++repetition) {
+            size_t calls = 0;
+            auto start = clock::now();
+            auto elapsed = clock::duration{};
+
+            do {
+                for (size_t i = 0; i != batch_size; ++i) {
+                    function();
+                }
+
+                calls += batch_size;
+                elapsed = clock::now() - start;
+            } while (elapsed < 1ms);
+
+            auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+            best_time = std::min(best_time, nanoseconds / static_cast<double>(calls));
+        }
+
+        return best_time;
+    }
+}// namespace cerb::debug
+
+#endif /* CERBERUS_BENCHMARK_HPP */
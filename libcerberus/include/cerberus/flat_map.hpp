@@ -4,6 +4,7 @@
 #include <cerberus/exception.hpp>
 #include <cerberus/memory.hpp>
 #include <cerberus/pair.hpp>
+#include <span>
 
 namespace cerb
 {
@@ -93,6 +94,7 @@ namespace cerb
 
             if (searched_elem == end()) {
                 this->emplace(key);
+                return storage[number_of_elems - 1].second;
             }
 
             return searched_elem->second;
@@ -138,6 +140,233 @@ namespace cerb
         storage_t storage{};
         size_t number_of_elems{ 0 };
     };
+
+    // Keys are kept sorted in a separate array. Integral keys are searched by counting keys,
+    // which are less than the given one: first among the last keys of cache line sized blocks,
+    // then inside the found block. Both loops have a fixed length, so they are vectorized by
+    // the compiler. Other keys use a branchless binary search.
+    template<std::totally_ordered Key, typename Value, size_t Size>
+    struct SortedFlatMap
+    {
+        static_assert(Size != 0);
+
+        using KeyForFlatMap = AutoCopyType<Key>;
+        using value_type = Pair<Key, Value, PairComparison::BY_FIRST_VALUE>;
+
+        constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+        constexpr static size_t cache_line_size = 64;
+        constexpr static size_t block_size =
+            min<size_t>(max<size_t>(cache_line_size / sizeof(Key), size_t{ 1 }), Size);
+        constexpr static size_t blocks_number = (Size + block_size - 1) / block_size;
+        constexpr static size_t keys_capacity = blocks_number * block_size;
+
+        // beyond that number of blocks binary search is faster than counting
+        constexpr static size_t max_counted_blocks = 64;
+
+        constexpr static bool use_counting_search = std::is_integral_v<Key> &&
+                                                    not std::is_same_v<Key, bool> &&
+                                                    blocks_number <= max_counted_blocks;
+
+        CERBLIB_DECL auto size() const -> size_t
+        {
+            return number_of_elems;
+        }
+
+        CERBLIB_DECL auto empty() const -> bool
+        {
+            return number_of_elems == 0;
+        }
+
+        CERBLIB_DECL auto getKeys() const -> std::span<Key const>
+        {
+            return { keys.data(), number_of_elems };
+        }
+
+        CERBLIB_DECL auto getValues() const -> std::span<Value const>
+        {
+            return { values.data(), number_of_elems };
+        }
+
+        // does nothing, if the key is already in the map
+        constexpr auto insert(value_type const &new_value) -> void
+        {
+            auto position = lowerBound(new_value.first);
+
+            if (position != number_of_elems && keys[position] == new_value.first) {
+                return;
+            }
+
+            throwWhenFull();
+
+            std::copy_backward(
+                keys.begin() + position, keys.begin() + number_of_elems,
+                keys.begin() + number_of_elems + 1);
+            std::move_backward(
+                values.begin() + position, values.begin() + number_of_elems,
+                values.begin() + number_of_elems + 1);
+
+            keys[position] = new_value.first;
+            values[position] = new_value.second;
+            ++number_of_elems;
+
+            updateBlockLasts();
+        }
+
+        template<typename... Ts>
+        constexpr auto emplace(KeyForFlatMap key, Ts &&...args) -> void
+        {
+            insert({ key, Value(args...) });
+        }
+
+        // index of the key in getKeys() or npos
+        CERBLIB_DECL auto find(KeyForFlatMap key) const -> size_t
+        {
+            size_t position = 0;
+
+            if constexpr (use_counting_search) {
+                position = countingLowerBound(key);
+            } else {
+                position = lowerBound(key);
+            }
+
+            if (position != number_of_elems && keys[position] == key) {
+                return position;
+            }
+
+            return npos;
+        }
+
+        CERBLIB_DECL auto contains(KeyForFlatMap key) const -> bool
+        {
+            return find(key) != npos;
+        }
+
+        CERBLIB_DECL auto count(KeyForFlatMap key) const -> u32
+        {
+            return static_cast<u32>(contains(key));
+        }
+
+        CERBLIB_DECL auto operator[](KeyForFlatMap key) -> Value &
+        {
+            return at(key);
+        }
+
+        CERBLIB_DECL auto operator[](KeyForFlatMap key) const -> Value const &
+        {
+            return at(key);
+        }
+
+        CERBLIB_DECL auto at(KeyForFlatMap key) -> Value &
+        {
+            auto index = find(key);
+
+            if (index == npos) {
+                this->emplace(key);
+                index = lowerBound(key);
+            }
+
+            return values[index];
+        }
+
+        CERBLIB_DECL auto at(KeyForFlatMap key) const -> Value const &
+        {
+            auto index = find(key);
+
+            if (index == npos) {
+                throw std::out_of_range("Cerberus flat map does not contains given element!");
+            }
+
+            return values[index];
+        }
+
+        SortedFlatMap() = default;
+
+        constexpr SortedFlatMap(std::initializer_list<value_type> const &storage_values)
+        {
+            auto insert_value = [this](value_type const &value) { this->insert(value); };
+            std::ranges::for_each(storage_values, insert_value);
+        }
+
+    private:
+        // counter has the same width as the key, so the loop does not widen vector lanes
+        template<size_t Length>
+        CERBLIB_DECL static auto countLess(Key const *keys_to_count, KeyForFlatMap key) -> size_t
+        {
+            using counter_t = std::make_unsigned_t<Key>;
+            static_assert(Length <= std::numeric_limits<counter_t>::max());
+
+            counter_t result = 0;
+
+            for (size_t i = 0; i != Length; ++i) {
+                result = static_cast<counter_t>(
+                    result + static_cast<counter_t>(keys_to_count[i] < key));
+            }
+
+            return result;
+        }
+
+        // same as lowerBound, relies on unused keys being equal to the maximum of Key
+        CERBLIB_DECL auto countingLowerBound(KeyForFlatMap key) const -> size_t
+        {
+            auto block = min(countLess<blocks_number>(block_lasts.data(), key), blocks_number - 1);
+            auto const *block_begin = keys.data() + block * block_size;
+
+            return block * block_size + countLess<block_size>(block_begin, key);
+        }
+
+        constexpr auto updateBlockLasts() -> void
+        {
+            if constexpr (use_counting_search) {
+                for (size_t block = 0; block != blocks_number; ++block) {
+                    block_lasts[block] = keys[block * block_size + block_size - 1];
+                }
+            }
+        }
+
+        template<size_t Length>
+        CERBLIB_DECL static auto unusedKeys() -> std::array<Key, Length>
+        {
+            std::array<Key, Length> result{};
+
+            if constexpr (use_counting_search) {
+                result.fill(std::numeric_limits<Key>::max());
+            }
+
+            return result;
+        }
+
+        // index of the first key, which is not less than the given one
+        CERBLIB_DECL auto lowerBound(KeyForFlatMap key) const -> size_t
+        {
+            if (number_of_elems == 0) {
+                return 0;
+            }
+
+            size_t base = 0;
+            size_t length = number_of_elems;
+
+            while (length > 1) {
+                auto half = length / 2;
+                base = keys[base + half] < key ? base + half : base;
+                length -= half;
+            }
+
+            return base + static_cast<size_t>(keys[base] < key);
+        }
+
+        constexpr auto throwWhenFull() const -> void
+        {
+            if (number_of_elems == Size) {
+                throw std::out_of_range("Cerberus flat map is full!");
+            }
+        }
+
+        std::array<Key, keys_capacity> keys{ unusedKeys<keys_capacity>() };
+        std::array<Key, blocks_number> block_lasts{ unusedKeys<blocks_number>() };
+        std::array<Value, Size> values{};
+        size_t number_of_elems{ 0 };
+    };
 }// namespace cerb
 
 #endif /* CERBERUS_FLAT_MAP_HPP */
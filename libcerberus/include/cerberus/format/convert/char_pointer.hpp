@@ -1,22 +1,31 @@
 #ifndef CERBERUS_CHAR_POINTER_HPP
 #define CERBERUS_CHAR_POINTER_HPP
 
-#include <cerberus/string_view.hpp>
-#include <string>
+#include <cerberus/format/convert/sink.hpp>
 
 namespace cerb::fmt
 {
-    template<CharacterLiteral CharT, CharacterLiteral T>
-    CERBLIB_DECL auto convert(T const *ptr) -> std::basic_string<CharT>
+    template<CharacterLiteral T>
+    CERBLIB_DECL auto estimateSize(T const *ptr) -> size_t
     {
-        std::basic_string<CharT> result{};
+        size_t length = 0;
+
+        while (ptr[length] != static_cast<T>(0)) {
+            ++length;
+        }
+
+        return length;
+    }
+
+    template<FormatSink Sink, CharacterLiteral T>
+    constexpr auto writeTo(Sink &sink, T const *ptr) -> void
+    {
+        using namespace private_;
 
         CERBLIB_UNROLL_N(2)
         for (; *ptr != static_cast<T>(0); ++ptr) {
-            result.push_back(static_cast<T>(*ptr));
+            sink.push_back(static_cast<SinkChar<Sink>>(*ptr));
         }
-
-        return result;
     }
 }// namespace cerb::fmt
 
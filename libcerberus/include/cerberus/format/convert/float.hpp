@@ -0,0 +1,488 @@
+#ifndef CERBERUS_FLOAT_HPP
+#define CERBERUS_FLOAT_HPP
+
+#include <cerberus/format/convert/int.hpp>
+#include <bit>
+
+namespace cerb::fmt
+{
+    template<typename T>
+    concept Ieee754Float = std::same_as<T, f32> || std::same_as<T, f64>;
+
+    namespace private_
+    {
+        struct U128
+        {
+            u64 low{};
+            u64 high{};
+        };
+
+        // Unsigned integer with 32-bit limbs. It is used only to build tables for Ryu at compile
+        // time, so it is as simple as possible.
+        template<size_t Limbs>
+        struct TableBigInt
+        {
+            constexpr static i32 limb_bits = 32;
+
+            constexpr auto multiply(u32 factor) -> void
+            {
+                u64 carry = 0;
+
+                for (auto &limb : limbs) {
+                    auto product = static_cast<u64>(limb) * factor + carry;
+                    limb = static_cast<u32>(product);
+                    carry = product >> limb_bits;
+                }
+            }
+
+            constexpr auto divide(u32 divisor) -> void
+            {
+                u64 remainder = 0;
+
+                for (auto it = limbs.rbegin(); it != limbs.rend(); ++it) {
+                    auto dividend = (remainder << limb_bits) | *it;
+                    *it = static_cast<u32>(dividend / divisor);
+                    remainder = dividend % divisor;
+                }
+            }
+
+            CERBLIB_DECL auto bitLength() const -> i32
+            {
+                for (auto i = static_cast<i32>(Limbs) - 1; i >= 0; --i) {
+                    auto limb = limbs[static_cast<size_t>(i)];
+
+                    if (limb != 0) {
+                        return i * limb_bits + static_cast<i32>(std::bit_width(limb));
+                    }
+                }
+
+                return 0;
+            }
+
+            CERBLIB_DECL auto bit(i32 index) const -> bool
+            {
+                if (logicalOr(index < 0, index >= static_cast<i32>(Limbs) * limb_bits)) {
+                    return false;
+                }
+
+                auto limb = limbs[static_cast<size_t>(index / limb_bits)];
+                return ((limb >> (index % limb_bits)) & 1U) != 0;
+            }
+
+            // lower 128 bits of the number shifted right by shift bits, negative shift is a shift
+            // to the left
+            CERBLIB_DECL auto shifted128(i32 shift) const -> U128
+            {
+                constexpr i32 word_bits = 64;
+                U128 result{};
+
+                for (i32 i = 0; i != word_bits; ++i) {
+                    result.low |= static_cast<u64>(bit(i + shift)) << i;
+                    result.high |= static_cast<u64>(bit(i + word_bits + shift)) << i;
+                }
+
+                return result;
+            }
+
+            constexpr explicit TableBigInt(u32 value)
+            {
+                limbs.front() = value;
+            }
+
+            std::array<u32, Limbs> limbs{};
+        };
+
+        constexpr i32 pow5_bitcount = 125;
+        constexpr i32 pow5_inv_bitcount = 125;
+        constexpr size_t pow5_table_size = 326;
+        constexpr size_t pow5_inv_table_size = 342;
+
+        // 5^i in 125 bits, tables of Ryu are built here instead of being written down
+        constexpr inline auto pow5_split = []() {
+            constexpr size_t limbs_for_pow5 = 25;
+
+            std::array<U128, pow5_table_size> table{};
+            TableBigInt<limbs_for_pow5> pow5{ 1 };
+
+            for (auto &entry : table) {
+                entry = pow5.shifted128(pow5.bitLength() - pow5_bitcount);
+                pow5.multiply(5);
+            }
+
+            return table;
+        }();
+
+        // floor(2^(bitLength(5^i) - 1 + 125) / 5^i) + 1
+        constexpr inline auto pow5_inv_split = []() {
+            constexpr size_t limbs_for_inv = 34;
+            constexpr i32 inv_scale_bits = 1024;
+
+            std::array<U128, pow5_inv_table_size> table{};
+            TableBigInt<limbs_for_inv> pow5{ 1 };
+            TableBigInt<limbs_for_inv> inv_pow5{ 0 };
+
+            inv_pow5.limbs[inv_scale_bits / TableBigInt<limbs_for_inv>::limb_bits] = 1;
+
+            for (auto &entry : table) {
+                auto scale = pow5.bitLength() - 1 + pow5_inv_bitcount;
+                entry = inv_pow5.shifted128(inv_scale_bits - scale);
+                entry.high += static_cast<u64>(++entry.low == 0);
+
+                pow5.multiply(5);
+                inv_pow5.divide(5);
+            }
+
+            return table;
+        }();
+
+        CERBLIB_DECL auto multiply128(u64 lhs, u64 rhs) -> U128
+        {
+#ifdef __SIZEOF_INT128__
+            __extension__ typedef unsigned __int128 uint128_t;// NOLINT
+
+            auto product = static_cast<uint128_t>(lhs) * rhs;
+            return { static_cast<u64>(product), static_cast<u64>(product >> 64U) };
+#else
+            constexpr u64 low_mask = 0xFFFF'FFFF;
+
+            auto lhs_low = lhs & low_mask;
+            auto lhs_high = lhs >> 32U;
+            auto rhs_low = rhs & low_mask;
+            auto rhs_high = rhs >> 32U;
+
+            auto low_low = lhs_low * rhs_low;
+            auto middle = lhs_high * rhs_low + (low_low >> 32U);
+            auto middle_with_carry = lhs_low * rhs_high + (middle & low_mask);
+
+            return { (middle_with_carry << 32U) | (low_low & low_mask),
+                     lhs_high * rhs_high + (middle >> 32U) + (middle_with_carry >> 32U) };
+#endif
+        }
+
+        // (m * mul) >> shift, where shift is in range (64, 128)
+        CERBLIB_DECL auto multiplyShift(u64 m, U128 const &mul, i32 shift) -> u64
+        {
+            auto low_product = multiply128(m, mul.low);
+            auto high_product = multiply128(m, mul.high);
+
+            auto sum = low_product.high + high_product.low;
+            auto high = high_product.high + static_cast<u64>(sum < low_product.high);
+            auto bits_in_high = static_cast<u32>(shift - 64);
+
+            return (high << (64U - bits_in_high)) | (sum >> bits_in_high);
+        }
+
+        // ceil(log2(5^e)) or 1 for zero
+        CERBLIB_DECL auto pow5Bits(i32 e) -> i32
+        {
+            return static_cast<i32>(((static_cast<u32>(e) * 1217359U) >> 19U) + 1U);
+        }
+
+        // floor(log10(2^e))
+        CERBLIB_DECL auto log10Pow2(i32 e) -> u32
+        {
+            return (static_cast<u32>(e) * 78913U) >> 18U;
+        }
+
+        // floor(log10(5^e))
+        CERBLIB_DECL auto log10Pow5(i32 e) -> u32
+        {
+            return (static_cast<u32>(e) * 732923U) >> 20U;
+        }
+
+        CERBLIB_DECL auto isMultipleOfPow5(u64 value, u32 power) -> bool
+        {
+            u32 count = 0;
+
+            for (; value % 5 == 0; value /= 5) {
+                ++count;
+            }
+
+            return count >= power;
+        }
+
+        CERBLIB_DECL auto isMultipleOfPow2(u64 value, u32 power) -> bool
+        {
+            return (value & ((1ULL << power) - 1)) == 0;
+        }
+
+        template<Ieee754Float Float>
+        struct FloatTraits
+        {
+            using bits_t = std::conditional_t<std::same_as<Float, f32>, u32, u64>;
+
+            constexpr static u32 mantissa_bits =
+                static_cast<u32>(std::numeric_limits<Float>::digits - 1);
+            constexpr static u32 exponent_bits =
+                static_cast<u32>(bitsizeof(Float)) - mantissa_bits - 1;
+            constexpr static i32 bias = std::numeric_limits<Float>::max_exponent - 1;
+        };
+
+        // value is mantissa * 10^exponent
+        struct DecimalFloat
+        {
+            u64 mantissa{};
+            i32 exponent{};
+        };
+
+        // Ryu by Ulf Adams. Tables of doubles are precise enough for floats, so both types share
+        // them and this function.
+        template<Ieee754Float Float>
+        CERBLIB_DECL auto toShortestDecimal(u64 ieee_mantissa, u32 ieee_exponent) -> DecimalFloat
+        {
+            using traits = FloatTraits<Float>;
+
+            // two additional bits are needed for the bounds
+            auto e2 = static_cast<i32>(ieee_exponent == 0 ? 1 : ieee_exponent) - traits::bias -
+                      static_cast<i32>(traits::mantissa_bits) - 2;
+            auto m2 = ieee_exponent == 0 ? ieee_mantissa
+                                         : (1ULL << traits::mantissa_bits) | ieee_mantissa;
+
+            bool accept_bounds = (m2 & 1U) == 0;
+            u64 mv = 4 * m2;
+            u64 mm_shift = static_cast<u64>(logicalOr(ieee_mantissa != 0, ieee_exponent <= 1));
+
+            u64 vr{};
+            u64 vp{};
+            u64 vm{};
+            i32 e10{};
+            bool vm_is_trailing_zeros = false;
+            bool vr_is_trailing_zeros = false;
+
+            if (e2 >= 0) {
+                auto q = log10Pow2(e2) - static_cast<u32>(e2 > 3);
+                auto k = pow5_inv_bitcount + pow5Bits(static_cast<i32>(q)) - 1;
+                auto shift = -e2 + static_cast<i32>(q) + k;
+                auto const &mul = pow5_inv_split[q];
+
+                e10 = static_cast<i32>(q);
+                vr = multiplyShift(mv, mul, shift);
+                vp = multiplyShift(mv + 2, mul, shift);
+                vm = multiplyShift(mv - 1 - mm_shift, mul, shift);
+
+                // only one of mp, mv and mm can be a multiple of 5
+                if (q <= 21) {
+                    if (mv % 5 == 0) {
+                        vr_is_trailing_zeros = isMultipleOfPow5(mv, q);
+                    } else if (accept_bounds) {
+                        vm_is_trailing_zeros = isMultipleOfPow5(mv - 1 - mm_shift, q);
+                    } else {
+                        vp -= static_cast<u64>(isMultipleOfPow5(mv + 2, q));
+                    }
+                }
+            } else {
+                auto q = log10Pow5(-e2) - static_cast<u32>(-e2 > 1);
+                auto i = -e2 - static_cast<i32>(q);
+                auto k = pow5Bits(i) - pow5_bitcount;
+                auto shift = static_cast<i32>(q) - k;
+                auto const &mul = pow5_split[static_cast<size_t>(i)];
+
+                e10 = static_cast<i32>(q) + e2;
+                vr = multiplyShift(mv, mul, shift);
+                vp = multiplyShift(mv + 2, mul, shift);
+                vm = multiplyShift(mv - 1 - mm_shift, mul, shift);
+
+                if (q <= 1) {
+                    // mv = 4 * m2, so it always has at least two trailing zero bits
+                    vr_is_trailing_zeros = true;
+
+                    if (accept_bounds) {
+                        vm_is_trailing_zeros = mm_shift == 1;
+                    } else {
+                        --vp;
+                    }
+                } else if (q < 63) {
+                    vr_is_trailing_zeros = isMultipleOfPow2(mv, q);
+                }
+            }
+
+            i32 removed = 0;
+            u64 last_removed_digit = 0;
+            u64 output{};
+
+            if (logicalOr(vm_is_trailing_zeros, vr_is_trailing_zeros)) {
+                while (vp / 10 > vm / 10) {
+                    vm_is_trailing_zeros &= vm % 10 == 0;
+                    vr_is_trailing_zeros &= last_removed_digit == 0;
+                    last_removed_digit = vr % 10;
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                    ++removed;
+                }
+
+                if (vm_is_trailing_zeros) {
+                    while (vm % 10 == 0) {
+                        vr_is_trailing_zeros &= last_removed_digit == 0;
+                        last_removed_digit = vr % 10;
+                        vr /= 10;
+                        vp /= 10;
+                        vm /= 10;
+                        ++removed;
+                    }
+                }
+
+                // round to even if the exact number is .....50..0
+                if (logicalAnd(vr_is_trailing_zeros, last_removed_digit == 5, vr % 2 == 0)) {
+                    last_removed_digit = 4;
+                }
+
+                auto is_vr_outside_bounds =
+                    logicalAnd(vr == vm, logicalOr(not accept_bounds, not vm_is_trailing_zeros));
+
+                output = vr + static_cast<u64>(
+                                  logicalOr(is_vr_outside_bounds, last_removed_digit >= 5));
+            } else {
+                bool round_up = false;
+
+                if (vp / 100 > vm / 100) {
+                    round_up = vr % 100 >= 50;
+                    vr /= 100;
+                    vp /= 100;
+                    vm /= 100;
+                    removed += 2;
+                }
+
+                while (vp / 10 > vm / 10) {
+                    round_up = vr % 10 >= 5;
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                    ++removed;
+                }
+
+                output = vr + static_cast<u64>(logicalOr(vr == vm, round_up));
+            }
+
+            return { output, e10 + removed };
+        }
+
+        template<CharacterLiteral CharT>
+        constexpr auto copyChars(CharT *out, char const *first, char const *last) -> CharT *
+        {
+            for (; first != last; ++first) {
+                *out++ = static_cast<CharT>(*first);
+            }
+
+            return out;
+        }
+
+        template<CharacterLiteral CharT>
+        constexpr auto fillChars(CharT *out, char chr, i32 count) -> CharT *
+        {
+            for (i32 i = 0; i < count; ++i) {
+                *out++ = static_cast<CharT>(chr);
+            }
+
+            return out;
+        }
+
+        // uses the shorter of fixed and scientific notations, fixed one in a tie
+        template<CharacterLiteral CharT>
+        constexpr auto writeDecimal(DecimalFloat const &decimal, CharT *out) -> CharT *
+        {
+            std::array<char, max_chars_in_int<u64>> digits{};
+            auto *digits_end = toChars(decimal.mantissa, digits.data());
+            auto *digits_begin = digits.data();
+
+            auto length = static_cast<i32>(digits_end - digits_begin);
+            auto exponent = decimal.exponent;
+            auto scientific_exponent = exponent + length - 1;
+
+            auto scientific_length = length + static_cast<i32>(length > 1) + 2 +
+                                     (abs(scientific_exponent) >= 100 ? 3 : 2);
+            auto fixed_length = exponent >= 0           ? length + exponent
+                                : length + exponent > 0 ? length + 1
+                                                        : 2 - exponent;
+
+            if (fixed_length <= scientific_length) {
+                if (exponent >= 0) {
+                    out = copyChars(out, digits_begin, digits_end);
+                    return fillChars(out, '0', exponent);
+                }
+
+                if (length + exponent > 0) {
+                    out = copyChars(out, digits_begin, digits_end + exponent);
+                    *out++ = static_cast<CharT>('.');
+                    return copyChars(out, digits_end + exponent, digits_end);
+                }
+
+                out = copyChars(out, "0.", "0." + 2);
+                out = fillChars(out, '0', -exponent - length);
+                return copyChars(out, digits_begin, digits_end);
+            }
+
+            *out++ = static_cast<CharT>(*digits_begin);
+
+            if (length > 1) {
+                *out++ = static_cast<CharT>('.');
+                out = copyChars(out, digits_begin + 1, digits_end);
+            }
+
+            *out++ = static_cast<CharT>('e');
+            *out++ = static_cast<CharT>(scientific_exponent < 0 ? '-' : '+');
+
+            if (abs(scientific_exponent) < 10) {
+                *out++ = static_cast<CharT>('0');
+            }
+
+            return toChars(abs(scientific_exponent), out);
+        }
+    }// namespace private_
+
+    // enough for the shortest representation of any value of Float
+    template<Ieee754Float Float>
+    constexpr inline size_t max_chars_in_float = std::numeric_limits<Float>::max_digits10 + 8;
+
+    // writes the shortest representation of the number, which is parsed back to the same value,
+    // to the buffer of at least max_chars_in_float<Float> chars and returns the end of the written
+    // chars. Significant digits are the same as the shortest digits of std::to_chars, but large
+    // integers are padded with zeros instead of their exact digits: 2^70 is written as
+    // 1180591620717411300000, not 1180591620717411303424.
+    template<CharacterLiteral CharT, Ieee754Float Float>
+    constexpr auto toChars(Float number, CharT *out) -> CharT *
+    {
+        using namespace private_;
+        using traits = FloatTraits<Float>;
+        using bits_t = typename traits::bits_t;
+
+        constexpr bits_t mantissa_mask = (bits_t{ 1 } << traits::mantissa_bits) - 1;
+        constexpr bits_t exponent_mask = (bits_t{ 1 } << traits::exponent_bits) - 1;
+
+        auto bits = std::bit_cast<bits_t>(number);
+        auto ieee_mantissa = static_cast<u64>(bits & mantissa_mask);
+        auto ieee_exponent = static_cast<u32>((bits >> traits::mantissa_bits) & exponent_mask);
+
+        if ((bits >> (traits::mantissa_bits + traits::exponent_bits)) != 0) {
+            *out++ = static_cast<CharT>('-');
+        }
+
+        if (ieee_exponent == exponent_mask) {
+            char const *special = ieee_mantissa == 0 ? "inf" : "nan";
+            return copyChars(out, special, special + 3);
+        }
+
+        if (logicalAnd(ieee_exponent == 0, ieee_mantissa == 0)) {
+            *out++ = static_cast<CharT>('0');
+            return out;
+        }
+
+        return writeDecimal(toShortestDecimal<Float>(ieee_mantissa, ieee_exponent), out);
+    }
+
+    // upper bound, the exact size is known only after the conversion
+    template<Ieee754Float Float>
+    CERBLIB_DECL auto estimateSize(Float /* unused */) -> size_t
+    {
+        return max_chars_in_float<Float>;
+    }
+
+    template<FormatSink Sink, Ieee754Float Float>
+    constexpr auto writeTo(Sink &sink, Float number) -> void
+    {
+        std::array<char, max_chars_in_float<Float>> buffer{};
+        private_::writeChars(sink, buffer.data(), toChars(number, buffer.data()));
+    }
+}// namespace cerb::fmt
+
+#endif /* CERBERUS_FLOAT_HPP */
@@ -1,103 +1,139 @@
 #ifndef CERBERUS_INT_HPP
 #define CERBERUS_INT_HPP
 
+#include <cerberus/format/convert/sink.hpp>
 #include <cerberus/number.hpp>
-#include <cerberus/string_view.hpp>
+#include <array>
+#include <bit>
 #include <string>
 
 namespace cerb::fmt
 {
     namespace private_
     {
-        template<CharacterLiteral CharT, std::integral Int>
-        struct IntConvert
-        {
-            CERBLIB_DECL auto moveConvertedNumber() -> std::basic_string<CharT>
-            {
-                return std::move(converted_number);
-            }
+        // decimal digits of numbers from 00 to 99, two chars per number
+        constexpr inline auto decimal_digit_pairs = []() {
+            constexpr size_t number_of_pairs = 100;
+            constexpr size_t decimal_notation = 10;
 
-            CERBLIB_DECL auto getConvertedNumber() const -> std::basic_string<CharT> const &
-            {
-                return converted_number;
-            }
+            std::array<char, number_of_pairs * 2> digit_pairs{};
 
-            IntConvert() = default;
-
-            constexpr explicit IntConvert(Int number_to_convert) : number(number_to_convert)
-            {
-                convertNumber();
+            for (size_t i = 0; i != number_of_pairs; ++i) {
+                digit_pairs[i * 2] = static_cast<char>('0' + i / decimal_notation);
+                digit_pairs[i * 2 + 1] = static_cast<char>('0' + i % decimal_notation);
             }
 
-        private:
-            constexpr auto convertNumber() -> void
-            {
-                if constexpr (CharacterLiteral<Int>) {
-                    converted_number = std::basic_string<CharT>{ cast(number) };
-                } else {
-                    addMinusIfNeed();
-                    processZeroNumber();
-                    fillBuffer();
-                    copyBufferToResult();
-                }
-            }
+            return digit_pairs;
+        }();
 
-            constexpr auto fillBuffer() -> void
-            {
-                constexpr int decimal_notation = 10;
+        constexpr inline auto powers_of_ten = []() {
+            constexpr u64 decimal_notation = 10;
 
-                while (number != 0) {
-                    character_buffer[--buffer_index] = cast('0' + number % decimal_notation);
-                    number /= decimal_notation;
-                }
-            }
+            std::array<u64, std::numeric_limits<u64>::digits10 + 1> powers{ 1 };
 
-            constexpr auto copyBufferToResult() -> void
-            {
-                CERBLIB_UNROLL_N(2)
-                for (; buffer_index != digits_in_number; ++buffer_index) {
-                    converted_number.push_back(character_buffer[buffer_index]);
-                }
+            for (size_t i = 1; i != powers.size(); ++i) {
+                powers[i] = powers[i - 1] * decimal_notation;
             }
 
-            constexpr auto processZeroNumber() -> void
-            {
-                if (number == 0) {
-                    converted_number.push_back(cast('0'));
-                }
-            }
+            return powers;
+        }();
 
-            constexpr auto addMinusIfNeed() -> void
-            {
-                if (number < 0) {
-                    converted_number.push_back(cast('-'));
-                }
+        template<std::unsigned_integral UInt>
+        CERBLIB_DECL auto countDigits(UInt value) -> size_t
+        {
+            // log10(2) is approximated by 1233 / 4096
+            constexpr size_t log10_of_two_multiplier = 1233;
+            constexpr size_t log10_of_two_shift = 12;
 
-                number = abs(number);
-            }
+            // powers of ten are even, so it only makes zero a single digit number
+            value |= 1U;
 
-            template<std::integral Integral>
-            CERBLIB_DECL static auto cast(Integral value) -> CharT
-            {
-                return static_cast<CharT>(value);
-            }
+            auto approximation =
+                (static_cast<size_t>(std::bit_width(value)) * log10_of_two_multiplier) >>
+                log10_of_two_shift;
 
-            constexpr static auto digits_in_number = std::numeric_limits<Int>::digits10 + 1;
+            return approximation + 1 - static_cast<size_t>(value < powers_of_ten[approximation]);
+        }
 
-            std::basic_string<CharT> converted_number{};
-            std::array<CharT, digits_in_number> character_buffer{};
-            size_t buffer_index = digits_in_number;
-            Int number{};
-        };
+        template<std::integral Int>
+        using UnsignedForDigits =
+            std::conditional_t<sizeof(Int) <= sizeof(u32), u32, std::make_unsigned_t<Int>>;
     }// namespace private_
 
+    // enough for all digits of Int and the minus sign
+    template<std::integral Int>
+    constexpr inline size_t max_chars_in_int = std::numeric_limits<Int>::digits10 + 2;
+
+    // writes decimal representation of the number to the buffer, which must have at least
+    // max_chars_in_int<Int> chars, and returns the end of the written chars
     template<CharacterLiteral CharT, std::integral Int>
-    constexpr auto convert(Int number) -> std::basic_string<CharT>
+    constexpr auto toChars(Int number, CharT *out) -> CharT *
+    {
+        using namespace private_;
+        using uint_t = UnsignedForDigits<Int>;
+
+        auto value = static_cast<uint_t>(number);
+
+        if constexpr (std::is_signed_v<Int>) {
+            if (number < 0) {
+                *out++ = static_cast<CharT>('-');
+                value = static_cast<uint_t>(0U - value);
+            }
+        }
+
+        constexpr uint_t hundred = 100;
+        CharT *end = out + countDigits(value);
+        CharT *it = end;
+
+        while (value >= hundred) {
+            auto index = static_cast<size_t>(value % hundred) * 2;
+            value /= hundred;
+
+            *--it = static_cast<CharT>(decimal_digit_pairs[index + 1]);
+            *--it = static_cast<CharT>(decimal_digit_pairs[index]);
+        }
+
+        if (value >= 10) {
+            *--it = static_cast<CharT>(decimal_digit_pairs[value * 2 + 1]);
+            *--it = static_cast<CharT>(decimal_digit_pairs[value * 2]);
+        } else {
+            *--it = static_cast<CharT>('0' + value);
+        }
+
+        return end;
+    }
+
+    template<std::integral Int>
+    CERBLIB_DECL auto estimateSize(Int number) -> size_t
+    {
+        using namespace private_;
+
+        if constexpr (CharacterLiteral<Int>) {
+            return 1;
+        } else {
+            auto value = static_cast<UnsignedForDigits<Int>>(number);
+
+            if constexpr (std::is_signed_v<Int>) {
+                if (number < 0) {
+                    return countDigits(static_cast<decltype(value)>(0U - value)) + 1;
+                }
+            }
+
+            return countDigits(value);
+        }
+    }
+
+    template<FormatSink Sink, std::integral Int>
+    constexpr auto writeTo(Sink &sink, Int number) -> void
     {
         using namespace private_;
 
-        IntConvert<CharT, Int> converter{ number };
-        return converter.moveConvertedNumber();
+        if constexpr (CharacterLiteral<Int>) {
+            sink.push_back(static_cast<SinkChar<Sink>>(number));
+        } else {
+            std::array<char, max_chars_in_int<Int>> buffer{};
+            writeChars(sink, buffer.data(), toChars(number, buffer.data()));
+        }
     }
 }// namespace cerb::fmt
 
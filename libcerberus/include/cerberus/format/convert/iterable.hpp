@@ -1,109 +1,129 @@
 #ifndef CERBERUS_ITERABLE_HPP
 #define CERBERUS_ITERABLE_HPP
 
-#include <cerberus/string_view.hpp>
-#include <string>
+#include <cerberus/format/convert/sink.hpp>
+#include <cerberus/pair.hpp>
+#include <array>
+#include <deque>
+#include <set>
+#include <utility>
+#include <vector>
 
 namespace cerb::fmt
 {
-    namespace private_
-    {
-        template<CharacterLiteral CharT, Iterable T>
-        struct IterableConverter
-        {
-            CERBLIB_DECL auto moveConvertedString() -> std::basic_string<CharT>
-            {
-                return std::move(conversion_result);
-            }
+    // converters of standard containers and pairs are defined in standart_containers.hpp, they are
+    // declared here to be visible for converters of their elements
+    template<typename T1, typename T2>
+    CERBLIB_DECL auto estimateSize(std::pair<T1, T2> const &pair) -> size_t;
 
-            CERBLIB_DECL auto getConvertedString() const -> std::basic_string<CharT> const &
-            {
-                return conversion_result;
-            }
+    template<typename T1, typename T2, PairComparison Rule>
+    CERBLIB_DECL auto estimateSize(Pair<T1, T2, Rule> const &pair) -> size_t;
 
-            IterableConverter() = default;
+    template<typename T, size_t N>
+    CERBLIB_DECL auto estimateSize(std::array<T, N> const &iterable_obj) -> size_t;
 
-            constexpr IterableConverter(
-                char begin_for_object, char end_for_object, T const &object_to_convert)
-              : converted_object(object_to_convert), object_begin(cast(begin_for_object)),
-                object_end(cast(end_for_object))
-            {
-                convertObject();
-            }
+    template<typename T, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::vector<T, Alloc> const &iterable_obj) -> size_t;
 
-        private:
-            constexpr auto convertObject() -> void
-            {
-                addBeginOfObject();
+    template<typename T, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::deque<T, Alloc> const &iterable_obj) -> size_t;
 
-                CERBLIB_UNROLL_N(2)
-                for (auto const &elem : converted_object) {
-                    addElem(elem);
-                }
+    template<typename Key, typename Compare, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::set<Key, Compare, Alloc> const &iterable_obj) -> size_t;
 
-                addEndOfObject();
-            }
+    template<FormatSink Sink, typename T1, typename T2>
+    constexpr auto writeTo(Sink &sink, std::pair<T1, T2> const &pair) -> void;
 
-            constexpr auto addElem(auto const &elem) -> void
-            {
-                conversion_result += convert<CharT>(elem);
-                addElemSeparator();
-            }
+    template<FormatSink Sink, typename T1, typename T2, PairComparison Rule>
+    constexpr auto writeTo(Sink &sink, Pair<T1, T2, Rule> const &pair) -> void;
 
-            constexpr auto addElemSeparator() -> void
-            {
-                conversion_result.push_back(cast(','));
-                conversion_result.push_back(cast(' '));
-            }
+    template<FormatSink Sink, typename T, size_t N>
+    constexpr auto writeTo(Sink &sink, std::array<T, N> const &iterable_obj) -> void;
 
-            constexpr auto addBeginOfObject() -> void
-            {
-                conversion_result.push_back(object_begin);
-            }
+    template<FormatSink Sink, typename T, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::vector<T, Alloc> const &iterable_obj) -> void;
 
-            constexpr auto addEndOfObject() -> void
-            {
-                if (std::size(converted_object) != 0) {
-                    conversion_result.pop_back();
-                    conversion_result.back() = object_end;
-                } else {
-                    conversion_result.push_back(object_end);
-                }
-            }
+    template<FormatSink Sink, typename T, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::deque<T, Alloc> const &iterable_obj) -> void;
 
-            template<std::integral Int>
-            CERBLIB_DECL static auto cast(Int value) -> CharT
-            {
-                return static_cast<CharT>(value);
-            }
+    template<FormatSink Sink, typename Key, typename Compare, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::set<Key, Compare, Alloc> const &iterable_obj)
+        -> void;
 
-            std::basic_string<CharT> conversion_result{};
-            T const &converted_object;
-            CharT object_begin{};
-            CharT object_end{};
-        };
+    namespace private_
+    {
+        template<Iterable T>
+        using IterableValue = std::remove_cvref_t<decltype(*std::declval<T const &>().begin())>;
 
-        template<CharacterLiteral CharT, Iterable T>
-        constexpr auto// NOLINTNEXTLINE
-            convertIterable(char object_begin, char object_end, T const &object_to_convert)
-                -> std::basic_string<CharT>
+        // elements of the object are separated by ", " and surrounded by the brackets
+        template<Iterable T>
+        CERBLIB_DECL auto estimateObjectSize(T const &object) -> size_t
         {
-            IterableConverter<CharT, T> converter{ object_begin, object_end, object_to_convert };
-            return converter.moveConvertedString();
+            constexpr size_t brackets_size = 2;
+            constexpr size_t separator_size = 2;
+
+            size_t size = brackets_size;
+
+            for (auto const &elem : object) {
+                size += estimateSize(elem) + separator_size;
+            }
+
+            return std::size(object) == 0 ? size : size - separator_size;
         }
 
+        template<FormatSink Sink, Iterable T>
+        constexpr auto
+            writeObject(Sink &sink, char object_begin, char object_end, T const &object) -> void
+        {
+            using char_t = SinkChar<Sink>;
+
+            bool is_first_elem = true;
+            sink.push_back(static_cast<char_t>(object_begin));
+
+            for (auto const &elem : object) {
+                if (not is_first_elem) {
+                    sink.push_back(static_cast<char_t>(','));
+                    sink.push_back(static_cast<char_t>(' '));
+                }
+
+                writeTo(sink, elem);
+                is_first_elem = false;
+            }
+
+            sink.push_back(static_cast<char_t>(object_end));
+        }
     }// namespace private_
 
-    template<CharacterLiteral CharT, Iterable T>
-    constexpr auto convert(T const &iterable_obj) -> std::basic_string<CharT>
+    // elements of iterable objects are written one after another, so strings are written as is
+    template<Iterable T>
+    CERBLIB_DECL auto estimateSize(T const &iterable_obj) -> size_t
     {
-        std::basic_string<CharT> result{};
+        if constexpr (CharacterLiteral<private_::IterableValue<T>>) {
+            return static_cast<size_t>(std::size(iterable_obj));
+        } else {
+            size_t size = 0;
+
+            for (auto const &elem : iterable_obj) {
+                size += estimateSize(elem);
+            }
 
-        for (auto const &elem : iterable_obj) {
-            result += convert<CharT>(elem);
+            return size;
         }
+    }
 
-        return result;
+    template<FormatSink Sink, Iterable T>
+    constexpr auto writeTo(Sink &sink, T const &iterable_obj) -> void
+    {
+        using namespace private_;
+
+        if constexpr (CharacterLiteral<IterableValue<T>> && requires { std::data(iterable_obj); }) {
+            auto const *first = std::data(iterable_obj);
+            writeChars(sink, first, first + std::size(iterable_obj));
+        } else {
+            for (auto const &elem : iterable_obj) {
+                writeTo(sink, elem);
+            }
+        }
     }
 }// namespace cerb::fmt
 
@@ -0,0 +1,102 @@
+#ifndef CERBERUS_SINK_HPP
+#define CERBERUS_SINK_HPP
+
+#include <cerberus/exception.hpp>
+#include <cerberus/string_view.hpp>
+#include <span>
+#include <string>
+
+namespace cerb::fmt
+{
+    CERBERUS_EXCEPTION(FmtConverterError, cerb::CerberusException);
+
+    // Output of formatting: std::basic_string, std::vector of chars or ArraySink
+    template<typename T>
+    concept FormatSink = CharacterLiteral<typename T::value_type> &&
+                         requires(T &sink, typename T::value_type chr, size_t size)
+    {
+        sink.push_back(chr);
+        sink.reserve(size);
+        {
+            sink.size()
+            } -> std::convertible_to<size_t>;
+        {
+            sink.capacity()
+            } -> std::convertible_to<size_t>;
+    };
+
+    // Sink over a fixed buffer, it throws FmtConverterError when the buffer is full
+    template<CharacterLiteral CharT>
+    class ArraySink
+    {
+    public:
+        using value_type = CharT;
+
+        CERBLIB_DECL auto size() const -> size_t
+        {
+            return length;
+        }
+
+        CERBLIB_DECL auto capacity() const -> size_t
+        {
+            return buffer.size();
+        }
+
+        CERBLIB_DECL auto view() const -> BasicStringView<CharT>
+        {
+            return { buffer.data(), length };
+        }
+
+        constexpr auto reserve(size_t /* unused */) -> void
+        {}
+
+        constexpr auto push_back(CharT chr) -> void
+        {
+            if (length == buffer.size()) {
+                throw FmtConverterError("Cerberus format buffer is full!");
+            }
+
+            buffer[length++] = chr;
+        }
+
+        constexpr explicit ArraySink(std::span<CharT> output_buffer) : buffer(output_buffer)
+        {}
+
+    private:
+        std::span<CharT> buffer{};
+        size_t length{};
+    };
+
+    namespace private_
+    {
+        template<FormatSink Sink>
+        using SinkChar = typename Sink::value_type;
+
+        // keeps geometric growth of the sink, when several values are written to it
+        template<FormatSink Sink>
+        constexpr auto reserveFor(Sink &sink, size_t additional_size) -> void
+        {
+            auto required_capacity = sink.size() + additional_size;
+
+            if (required_capacity > sink.capacity()) {
+                sink.reserve(max(required_capacity, sink.capacity() * 2));
+            }
+        }
+
+        template<FormatSink Sink, CharacterLiteral T>
+        constexpr auto writeChars(Sink &sink, T const *first, T const *last) -> void
+        {
+            using char_t = SinkChar<Sink>;
+
+            if constexpr (std::is_same_v<Sink, std::basic_string<T>>) {
+                sink.append(first, last);
+            } else {
+                for (; first != last; ++first) {
+                    sink.push_back(static_cast<char_t>(*first));
+                }
+            }
+        }
+    }// namespace private_
+}// namespace cerb::fmt
+
+#endif /* CERBERUS_SINK_HPP */
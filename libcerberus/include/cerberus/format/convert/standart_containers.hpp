@@ -3,91 +3,105 @@
 
 #include <cerberus/format/convert/iterable.hpp>
 
-#define CCHAR(x) static_cast<CharT>(x)
-
-// NOLINTNEXTLINE
-namespace std
-{
-    template<typename T, size_t N>
-    struct array;
-
-    template<typename Key, typename Compare, typename Alloc>
-    struct set;
-
-    template<typename T, typename Alloc>
-    struct vector;
-
-    template<typename T, typename Alloc>
-    struct deque;
-
-    template<typename T1, typename T2>
-    struct pair;
-}// namespace std
-
-namespace cerb
-{
-    enum struct PairComparison : u16;
-
-    template<typename T1, typename T2, PairComparison>
-    class Pair;
-}// namespace cerb
-
 namespace cerb::fmt
 {
-    template<typename CharT, typename... Ts>
-    CERBLIB_DECL auto format(BasicStringView<char> const &formatter, Ts &&...args)
-        -> std::basic_string<CharT>;
+    namespace private_
+    {
+        // pairs are written as "{first, second}"
+        template<Pairable T>
+        CERBLIB_DECL auto estimatePairSize(T const &pair) -> size_t
+        {
+            constexpr size_t brackets_and_separator_size = 4;
+            return estimateSize(pair.first) + estimateSize(pair.second) +
+                   brackets_and_separator_size;
+        }
+
+        template<FormatSink Sink, Pairable T>
+        constexpr auto writePair(Sink &sink, T const &pair) -> void
+        {
+            using char_t = SinkChar<Sink>;
+
+            sink.push_back(static_cast<char_t>('{'));
+            writeTo(sink, pair.first);
+            sink.push_back(static_cast<char_t>(','));
+            sink.push_back(static_cast<char_t>(' '));
+            writeTo(sink, pair.second);
+            sink.push_back(static_cast<char_t>('}'));
+        }
+    }// namespace private_
 
-    template<CharacterLiteral CharT, typename T1, typename T2>
-    CERBLIB_DECL auto convert(std::pair<T1, T2> const &pair) -> std::basic_string<CharT>
+    template<typename T1, typename T2>
+    CERBLIB_DECL auto estimateSize(std::pair<T1, T2> const &pair) -> size_t
     {
-        using namespace private_;
+        return private_::estimatePairSize(pair);
+    }
 
-        return format<CharT>("{{{}, {}}}", pair.first, pair.second);
+    template<typename T1, typename T2, PairComparison Rule>
+    CERBLIB_DECL auto estimateSize(Pair<T1, T2, Rule> const &pair) -> size_t
+    {
+        return private_::estimatePairSize(pair);
     }
 
-    template<CharacterLiteral CharT, typename T1, typename T2, PairComparison Rule>
-    CERBLIB_DECL auto convert(Pair<T1, T2, Rule> const &pair) -> std::basic_string<CharT>
+    template<typename T, size_t N>
+    CERBLIB_DECL auto estimateSize(std::array<T, N> const &iterable_obj) -> size_t
     {
-        using namespace private_;
+        return private_::estimateObjectSize(iterable_obj);
+    }
 
-        return format<CharT>("{{{}, {}}}", pair.first, pair.second);
+    template<typename T, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::vector<T, Alloc> const &iterable_obj) -> size_t
+    {
+        return private_::estimateObjectSize(iterable_obj);
     }
 
-    template<CharacterLiteral CharT, typename T, size_t N>
-    CERBLIB_DECL auto convert(std::array<T, N> const &iterable_obj) -> std::basic_string<CharT>
+    template<typename T, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::deque<T, Alloc> const &iterable_obj) -> size_t
     {
-        using namespace private_;
+        return private_::estimateObjectSize(iterable_obj);
+    }
 
-        return convertIterable<CharT, std::array<T, N>>('[', ']', iterable_obj);
+    template<typename Key, typename Compare, typename Alloc>
+    CERBLIB_DECL auto estimateSize(std::set<Key, Compare, Alloc> const &iterable_obj) -> size_t
+    {
+        return private_::estimateObjectSize(iterable_obj);
     }
 
-    template<CharacterLiteral CharT, typename T, typename Alloc>
-    CERBLIB_DECL auto convert(std::vector<T, Alloc> const &iterable_obj) -> std::basic_string<CharT>
+    template<FormatSink Sink, typename T1, typename T2>
+    constexpr auto writeTo(Sink &sink, std::pair<T1, T2> const &pair) -> void
     {
-        using namespace private_;
+        private_::writePair(sink, pair);
+    }
 
-        return convertIterable<CharT, std::vector<T, Alloc>>('[', ']', iterable_obj);
+    template<FormatSink Sink, typename T1, typename T2, PairComparison Rule>
+    constexpr auto writeTo(Sink &sink, Pair<T1, T2, Rule> const &pair) -> void
+    {
+        private_::writePair(sink, pair);
     }
 
-    template<CharacterLiteral CharT, typename T, typename Alloc>
-    CERBLIB_DECL auto convert(std::deque<T, Alloc> const &iterable_obj) -> std::basic_string<CharT>
+    template<FormatSink Sink, typename T, size_t N>
+    constexpr auto writeTo(Sink &sink, std::array<T, N> const &iterable_obj) -> void
     {
-        using namespace private_;
+        private_::writeObject(sink, '[', ']', iterable_obj);
+    }
 
-        return convertIterable<CharT, std::deque<T, Alloc>>('[', ']', iterable_obj);
+    template<FormatSink Sink, typename T, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::vector<T, Alloc> const &iterable_obj) -> void
+    {
+        private_::writeObject(sink, '[', ']', iterable_obj);
     }
 
-    template<CharacterLiteral CharT, typename Key, typename Compare, typename Alloc>
-    CERBLIB_DECL auto convert(std::set<Key, Compare, Alloc> const &iterable_obj)
-        -> std::basic_string<CharT>
+    template<FormatSink Sink, typename T, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::deque<T, Alloc> const &iterable_obj) -> void
     {
-        using namespace private_;
+        private_::writeObject(sink, '[', ']', iterable_obj);
+    }
 
-        return convertIterable<CharT, std::set<Key, Compare, Alloc>>('{', '}', iterable_obj);
+    template<FormatSink Sink, typename Key, typename Compare, typename Alloc>
+    constexpr auto writeTo(Sink &sink, std::set<Key, Compare, Alloc> const &iterable_obj)
+        -> void
+    {
+        private_::writeObject(sink, '{', '}', iterable_obj);
     }
 }// namespace cerb::fmt
 
-#undef CCHAR
-
 #endif /* CERBERUS_STANDART_CONTAINERS_HPP */
@@ -2,199 +2,180 @@
 #define CERBERUS_FORMAT_HPP
 
 #include <cerberus/format/convert/char_pointer.hpp>
+#include <cerberus/format/convert/float.hpp>
 #include <cerberus/format/convert/int.hpp>
 #include <cerberus/format/convert/iterable.hpp>
+#include <cerberus/format/convert/sink.hpp>
 #include <cerberus/format/convert/standart_containers.hpp>
 #include <cerberus/lex/char.hpp>
 
 namespace cerb::fmt
 {
-    CERBERUS_EXCEPTION(FmtConverterError, cerb::CerberusException);
-
     namespace private_
     {
-        template<CharacterLiteral CharT>
-        struct Converter
+        struct FormatSegment
         {
-            CERBLIB_DECL auto moveFormattedString() -> std::basic_string<CharT>
-            {
-                return std::move(formatted_string);
-            }
+            size_t offset{};
+            size_t length{};
+            bool has_escapes{};
+        };
+    }// namespace private_
 
-            CERBLIB_DECL auto getFormattedString() const -> std::basic_string<CharT> const &
-            {
-                return formatted_string;
-            }
+    // Format string, which is split into literal segments and placeholders at compile time.
+    // Number of placeholders is checked against the number of arguments during the split.
+    template<typename... Ts>
+    class FormatString
+    {
+        using segment_t = private_::FormatSegment;
 
-            Converter() = default;
+    public:
+        constexpr static size_t number_of_segments = sizeof...(Ts) + 1;
 
-            template<typename... Ts>
-            constexpr explicit Converter(string_view const &string_to_format, Ts &&...args)
-              : formatter(string_to_format)
-            {
-                formatString(std::forward<Ts>(args)...);
-            }
+        CERBLIB_DECL auto getFormatter() const -> string_view const &
+        {
+            return formatter;
+        }
 
-        private:
-            template<std::integral Int>
-            CERBLIB_DECL static auto cast(Int value) -> CharT
-            {
-                return static_cast<CharT>(value);
-            }
+        // segment i is followed by the i-th argument
+        CERBLIB_DECL auto getSegments() const -> std::array<segment_t, number_of_segments> const &
+        {
+            return segments;
+        }
 
-            constexpr auto formatString() -> void
-            {
-                while (canContinueFormatting()) {
-                    CharT chr = getChar();
-                    processChar(chr);
-                }
-            }
+        // number of chars in the literal segments after unescaping of brackets
+        CERBLIB_DECL auto getLiteralsSize() const -> size_t
+        {
+            return literals_size;
+        }
 
-            template<typename T, typename... Ts>
-            constexpr auto formatString(T const &value, Ts &&...args) -> void
-            {
-                while (canContinueFormatting()) {
-                    CharT chr = getChar();
-                    processChar(chr);
-                    convertValueIfNeed(value, std::forward<Ts>(args)...);
-                }
-            }
+        template<size_t N>// NOLINTNEXTLINE
+        consteval FormatString(char const (&string_to_format)[N])
+          : FormatString(string_view{ string_to_format, N - 1 })
+        {}
 
-            constexpr auto processChar(CharT chr) -> void
-            {
-                switch (chr) {
-                case cast('{'):
-                    processOpeningBracket();
-                    break;
+        // NOLINTNEXTLINE
+        consteval FormatString(string_view const &string_to_format) : formatter(string_to_format)
+        {
+            splitFormatter();
+        }
 
-                case cast('}'):
-                    processClosingBracket();
-                    break;
+    private:
+        consteval auto splitFormatter() -> void
+        {
+            size_t segment_begin = 0;
+            size_t placeholders = 0;
+            bool has_escapes = false;
 
-                default:
-                    checkForOpenFmt();
-                    appendChar(chr);
-                }
-            }
+            for (size_t i = 0; i < formatter.size(); ++i) {
+                char chr = formatter[i];
 
-            constexpr auto processOpeningBracket() -> void
-            {
-                CharT chr = getFutureChar();
+                if (logicalAnd(chr != '{', chr != '}')) {
+                    ++literals_size;
+                    continue;
+                }
 
-                if (chr == cast('{')) {
-                    appendChar(chr);
-                    nextChar();
-                } else {
-                    fmt_open = true;
+                if (logicalAnd(i + 1 < formatter.size(), formatter[i + 1] == chr)) {
+                    has_escapes = true;
+                    ++literals_size;
+                    ++i;
+                    continue;
                 }
-            }
 
-            constexpr auto processClosingBracket() -> void
-            {
-                CharT chr = getFutureChar();
+                checkPlaceholder(i, placeholders);
+                segments[placeholders++] = { segment_begin, i - segment_begin, has_escapes };
 
-                if (logicalAnd(not fmt_open, chr == cast('}'))) {
-                    appendChar(chr);
-                    nextChar();
-                } else {
-                    fmt_open = false;
-                    need_to_print_value = true;
-                }
+                has_escapes = false;
+                segment_begin = ++i + 1;
             }
 
-            template<typename T, typename... Ts>
-            constexpr auto convertValueIfNeed(T const &value, Ts &&...args) -> void
-            {
-                if (need_to_print_value) {
-                    convertValue(value);
-                    formatString(std::forward<Ts>(args)...);
-                }
+            if (placeholders != sizeof...(Ts)) {
+                throw FmtConverterError("Too many arguments have been passed to formatting");
             }
 
-            constexpr auto checkThatValueDoesNotNeedToBePrinted() const -> void
-            {
-                if (need_to_print_value) {
-                    throw FmtConverterError("Too many arguments have been past to formatting");
-                }
-            }
+            segments.back() = { segment_begin, formatter.size() - segment_begin, has_escapes };
+        }
 
-            template<typename T>
-            constexpr auto convertValue(T const &value) -> void
-            {
-                formatted_string += cerb::fmt::convert<CharT>(value);
-                need_to_print_value = false;
+        consteval auto checkPlaceholder(size_t index, size_t placeholders) const -> void
+        {
+            if (formatter[index] == '}') {
+                throw FmtConverterError("Unmatched '}' in format string");
             }
 
-            constexpr auto canContinueFormatting() -> bool
-            {
-                CharT chr = nextChar();
-                return not lex::isEoF(chr);
+            if (logicalOr(index + 1 == formatter.size(), formatter[index + 1] != '}')) {
+                throw FmtConverterError(
+                    "Arguments for cerb::fmt::format are not supported at the moment!");
             }
 
-            constexpr auto appendChar(CharT chr) -> void
-            {
-                formatted_string.push_back(chr);
+            if (placeholders == sizeof...(Ts)) {
+                throw FmtConverterError("Too few arguments have been passed to formatting");
             }
+        }
 
-            CERBLIB_DECL auto getChar() -> CharT
-            {
-                if (not canAccessChar()) {
-                    return lex::CharEnum<CharT>::EoF;
-                }
+        std::array<segment_t, number_of_segments> segments{};
+        string_view formatter{};
+        size_t literals_size{};
+    };
 
-                return cast(formatter[current_char_index]);
-            }
+    namespace private_
+    {
+        template<FormatSink Sink>
+        constexpr auto writeSegment(
+            Sink &sink, string_view const &formatter, FormatSegment const &segment) -> void
+        {
+            using char_t = SinkChar<Sink>;
 
-            CERBLIB_DECL auto getFutureChar() const -> CharT
-            {
-                if (not canAccessChar(1)) {
-                    return lex::CharEnum<CharT>::EoF;
-                }
+            auto const *begin = formatter.data() + segment.offset;
 
-                return cast(formatter[current_char_index + 1]);
+            if (not segment.has_escapes) {
+                writeChars(sink, begin, begin + segment.length);
+                return;
             }
 
-            constexpr auto nextChar() -> CharT
-            {
-                if (not initialized) {
-                    initialized = true;
-                } else {
-                    ++current_char_index;
-                }
-
-                return getChar();
+            for (auto const *it = begin; it != begin + segment.length; ++it) {
+                sink.push_back(static_cast<char_t>(*it));
+                it += static_cast<ptrdiff_t>(logicalOr(*it == '{', *it == '}'));
             }
+        }
+    }// namespace private_
 
-            CERBLIB_DECL auto canAccessChar(size_t offset = 0) const -> bool
-            {
-                return logicalAnd(initialized, current_char_index + offset < formatter.size());
-            }
+    template<CharacterLiteral CharT, typename T>
+    CERBLIB_DECL auto convert(T const &value) -> std::basic_string<CharT>
+    {
+        std::basic_string<CharT> result{};
+        result.reserve(estimateSize(value));
+        writeTo(result, value);
+        return result;
+    }
 
-            constexpr auto checkForOpenFmt() const -> void
-            {
-                if (fmt_open) {
-                    throw FmtConverterError(
-                        "Arguments for cerb::fmt::format are not supported at the "
-                        "moment!");
-                }
-            }
+    // Appends formatted arguments to the sink. Sink is reserved once, since the size of literals
+    // is known at compile time and the size of arguments is estimated before writing.
+    template<FormatSink Sink, typename... Ts>
+    constexpr auto formatTo(
+        Sink &sink, FormatString<std::type_identity_t<Ts>...> const &formatter, Ts &&...args)
+        -> void
+    {
+        using namespace private_;
 
-            std::basic_string<CharT> formatted_string{};
-            string_view formatter{};
-            size_t current_char_index{};
-            bool fmt_open{};
-            bool initialized{};
-            bool need_to_print_value{};
-        };
-    }// namespace private_
+        auto const &segments = formatter.getSegments();
+        size_t segment_index = 0;
+
+        reserveFor(sink, formatter.getLiteralsSize() + (size_t{} + ... + estimateSize(args)));
+
+        ((writeSegment(sink, formatter.getFormatter(), segments[segment_index++]),
+          writeTo(sink, args)),
+         ...);
+
+        writeSegment(sink, formatter.getFormatter(), segments.back());
+    }
 
     template<typename CharT, typename... Ts>
-    CERBLIB_DECL auto format(string_view const &formatter, Ts &&...args) -> std::basic_string<CharT>
+    CERBLIB_DECL auto
+        format(FormatString<std::type_identity_t<Ts>...> const &formatter, Ts &&...args)
+            -> std::basic_string<CharT>
     {
-        using namespace private_;
-
-        Converter<CharT> converter{ formatter, std::forward<Ts>(args)... };
-        return converter.moveFormattedString();
+        std::basic_string<CharT> result{};
+        formatTo<std::basic_string<CharT>, Ts...>(result, formatter, std::forward<Ts>(args)...);
+        return result;
     }
 }// namespace cerb::fmt
 
@@ -2,41 +2,201 @@
 #define CERBERUS_LAZY_EXECUTOR_HPP
 
 #include <any>
+#include <atomic>
+#include <cerberus/cancellation.hpp>
 #include <cerberus/cerberus.hpp>
+#include <cerberus/cpu_topology.hpp>
 #include <cerberus/exception.hpp>
 #include <cerberus/memory.hpp>
+#include <cerberus/number.hpp>
+#include <chrono>
 #include <deque>
 #include <functional>
 #include <list>
 #include <mutex>
 #include <semaphore>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 namespace cerb
 {
+    struct ElasticScalingOptions
+    {
+        size_t min_threads{ 1 };
+        size_t max_threads{ max<size_t>(1, std::thread::hardware_concurrency()) };
+        std::chrono::milliseconds latency_target{ 10 };
+        std::chrono::milliseconds idle_period{ 1000 };
+        std::chrono::milliseconds check_period{ 5 };
+    };
+
+    struct WorkerPlacementOptions
+    {
+        std::vector<u32> cpus{};
+        std::string thread_name{};
+        bool numa_aware{ false };
+    };
+
     template<typename ReturnType = std::any>
     class LazyExecutor
     {
     private:
+        using clock = std::chrono::steady_clock;
         using job_function_t = std::function<ReturnType()>;
+        using cancellable_job_function_t = std::function<ReturnType(CancellationToken const &)>;
         using completion_function_t = std::function<void(ReturnType)>;
 
         struct Action
         {
             job_function_t job;
             completion_function_t completion;
+            CancellationToken token{};
+            clock::time_point enqueue_time{};
+        };
+
+        struct Lane
+        {
+            std::deque<Action> actions{};
+            size_t weight{ 1 };
+            ssize_t current_weight{ 0 };
+        };
+
+        // Jobs are stored in priority lanes: FIFO inside a lane and smooth weighted round-robin
+        // between non-empty lanes, so a lane with weight W gets W / (sum of weights) of the
+        // dequeues while all lanes are busy and none of them can be starved.
+        // All methods expect the lock to be held by the caller.
+        struct ActionQueue
+        {
+            [[nodiscard]] auto empty() const -> bool
+            {
+                return std::ranges::all_of(
+                    lanes, [](Lane const &lane) { return lane.actions.empty(); });
+            }
+
+            auto push(Action &&action, size_t lane_index) -> void
+            {
+                Lane &lane = lanes[min(lane_index, lanes.size() - 1)];
+                lane.actions.push_back(std::move(action));
+            }
+
+            auto tryPop(Action &action) -> bool
+            {
+                Lane *selected_lane = nullptr;
+                ssize_t total_weight = 0;
+
+                for (Lane &lane : lanes) {
+                    if (lane.actions.empty()) {
+                        lane.current_weight = 0;
+                        continue;
+                    }
+
+                    lane.current_weight += static_cast<ssize_t>(lane.weight);
+                    total_weight += static_cast<ssize_t>(lane.weight);
+
+                    if (selected_lane == nullptr ||
+                        lane.current_weight >= selected_lane->current_weight) {
+                        selected_lane = &lane;
+                    }
+                }
+
+                if (selected_lane == nullptr) {
+                    return false;
+                }
+
+                selected_lane->current_weight -= total_weight;
+                action = std::move(selected_lane->actions.front());
+                selected_lane->actions.pop_front();
+
+                return true;
+            }
+
+            auto setLanes(std::vector<size_t> const &weights) -> void
+            {
+                std::vector<Lane> new_lanes(weights.size());
+
+                for (size_t i = 0; i != weights.size(); ++i) {
+                    new_lanes[i].weight = max<size_t>(1, weights[i]);
+                }
+
+                for (size_t i = 0; i != lanes.size(); ++i) {
+                    auto &new_lane = new_lanes[min(i, new_lanes.size() - 1)];
+                    std::ranges::move(lanes[i].actions, std::back_inserter(new_lane.actions));
+                }
+
+                lanes = std::move(new_lanes);
+            }
+
+            template<typename F>
+            auto forEachAction(F &&function) const -> void
+            {
+                for (Lane const &lane : lanes) {
+                    std::ranges::for_each(lane.actions, function);
+                }
+            }
+
+            std::vector<Lane> lanes{ Lane{ .weight = 1 }, Lane{ .weight = 8 } };
+            std::mutex lock{};
+        };
+
+        struct Worker
+        {
+            std::vector<u32> cpus{};
+            size_t index{};
+            size_t queue_index{};
         };
 
     public:
-        [[nodiscard]] auto threadsNumber() const -> size_t
+        [[nodiscard]] auto threadsNumber() -> size_t
         {
+            std::scoped_lock lock{ threads_lock };
             return threads_storage.size();
         }
 
+        [[nodiscard]] auto queuesNumber() const -> size_t
+        {
+            return queues.size();
+        }
+
+        [[nodiscard]] auto lanesNumber() const -> size_t
+        {
+            return lanes_number.load();
+        }
+
+        // lanes are ordered by priority: 0 is the lane of ordinary jobs, the last one is used
+        // by addPriorityJob
+        auto setPriorityLanes(std::vector<size_t> const &weights) -> void
+        {
+            if (weights.empty()) {
+                throw std::invalid_argument("LazyExecutor requires at least one priority lane!");
+            }
+
+            for (ActionQueue &queue : queues) {
+                std::scoped_lock lock{ queue.lock };
+                queue.setLanes(weights);
+            }
+
+            lanes_number.store(weights.size());
+        }
+
+        auto addJobToLane(size_t lane, Action action) -> void
+        {
+            ActionQueue &queue = selectQueue();
+            std::scoped_lock lock{ queue.lock };
+
+            action.enqueue_time = clock::now();
+            queue.push(std::move(action), lane);
+        }
+
+        auto addJobToLane(
+            size_t lane, job_function_t job, completion_function_t completion = emptyFunction)
+            -> void
+        {
+            addJobToLane(lane, Action{ job, completion });
+        }
+
         auto addJob(Action action) -> void
         {
-            std::scoped_lock lock{ queue_lock };
-            actions_queue.push_back(std::move(action));
+            addJobToLane(0, std::move(action));
         }
 
         auto addJob(job_function_t job, completion_function_t completion = emptyFunction) -> void
@@ -46,8 +206,7 @@ namespace cerb
 
         auto addPriorityJob(Action action) -> void
         {
-            std::scoped_lock lock{ queue_lock };
-            actions_queue.push_front(std::move(action));
+            addJobToLane(lanes_number.load() - 1, std::move(action));
         }
 
         auto addPriorityJob(job_function_t job, completion_function_t completion = emptyFunction)
@@ -56,31 +215,75 @@ namespace cerb
             addPriorityJob(Action{ job, completion });
         }
 
+        // job is dropped without calling completion if the token is cancelled before the job
+        // starts or if the job throws OperationCancelledError
+        auto addCancellableJob(
+            cancellable_job_function_t job, CancellationToken const &token,
+            completion_function_t completion = emptyFunction, size_t lane = 0) -> void
+        {
+            auto job_with_token = [cancellable_job = std::move(job), token]() {
+                return cancellable_job(token);
+            };
+
+            addJobToLane(lane, Action{ job_with_token, completion, token });
+        }
+
         auto addThread() -> void
         {
-            threads_run_flag.emplace_back(true);
+            std::scoped_lock lock{ threads_lock };
+            workers.push_back(makeWorker(threads_storage.size()));
 
-            auto &run_flag = threads_run_flag.back();
-            threads_storage.emplace_back(threadLoop, std::ref(*this), std::ref(run_flag));
+            auto &worker = workers.back();
+            threads_storage.emplace_back(threadLoop, std::ref(*this), std::ref(worker));
         }
 
+        // thread is joined outside of the lock, so a long job of the removed thread does not block
+        // the other methods of the executor
         auto removeThread() -> void
         {
-            if (threads_storage.size() > 1) {
-                auto &last_thread = threads_storage.back();
+            std::list<std::jthread> removed_thread{};
+            std::list<Worker> removed_worker{};
 
-                threads_run_flag.back() = false;
-                last_thread.join();
+            {
+                std::scoped_lock lock{ threads_lock };
+
+                if (threads_storage.size() <= 1) {
+                    return;
+                }
 
-                threads_storage.pop_back();
-                threads_run_flag.pop_back();
+                removed_thread.splice(
+                    removed_thread.end(), threads_storage, std::prev(threads_storage.end()));
+                removed_worker.splice(removed_worker.end(), workers, std::prev(workers.end()));
             }
+
+            removed_thread.front().request_stop();
+            removed_thread.front().join();
+        }
+
+        auto enableElasticScaling(ElasticScalingOptions const &options) -> void
+        {
+            disableElasticScaling();
+
+            scaling_options = options;
+            scaling_options.min_threads = max<size_t>(1, scaling_options.min_threads);
+            scaling_options.max_threads =
+                max(scaling_options.min_threads, scaling_options.max_threads);
+
+            scaling_enabled = true;
+            startScalingController();
+        }
+
+        auto disableElasticScaling() -> void
+        {
+            scaling_enabled = false;
+            stopScalingController();
         }
 
         auto stop() -> void
         {
+            stopScalingController();
             waitUntilQueueIsEmpty();
-            std::scoped_lock lock{ queue_lock };
+            std::scoped_lock lock{ threads_lock };
             joinAllRunningThreads();
         }
 
@@ -89,6 +292,10 @@ namespace cerb
             stop();
             run = true;
             restartThreads();
+
+            if (scaling_enabled) {
+                startScalingController();
+            }
         }
 
         auto operator=(LazyExecutor &&) -> LazyExecutor & = delete;
@@ -97,7 +304,11 @@ namespace cerb
         LazyExecutor(LazyExecutor &&) = delete;
         LazyExecutor(LazyExecutor const &) = delete;
 
-        explicit LazyExecutor(size_t threads_count = 4)
+        explicit LazyExecutor(
+            size_t threads_count = 4, WorkerPlacementOptions placement_options = {})
+          : placement(std::move(placement_options)),
+            topology(placement.numa_aware ? CpuTopology::load() : CpuTopology{}),
+            queues(placement.numa_aware ? topology.numberOfNodes() : 1)
         {
             for (size_t i = 0; i < threads_count; ++i) {
                 addThread();
@@ -110,36 +321,44 @@ namespace cerb
         }
 
     private:
-        static auto threadLoop(LazyExecutor &executor, bool const &run_flag) -> void
+        static auto threadLoop(
+            std::stop_token const &stop_token, LazyExecutor &executor, Worker const &worker) -> void
         {
-            while (logicalAnd(executor.run, run_flag)) {
-                tryToGrabAndExecuteTask(executor);
+            executor.applyPlacement(worker);
+
+            while (logicalAnd(executor.run, not stop_token.stop_requested())) {
+                tryToGrabAndExecuteTask(executor, worker);
             }
         }
 
-        static auto tryToGrabAndExecuteTask(LazyExecutor &executor) -> void
+        static auto tryToGrabAndExecuteTask(LazyExecutor &executor, Worker const &worker) -> void
         {
             using namespace std::chrono_literals;
 
             Action action{};
 
-            if (tryToGrabAction(executor, action)) {
+            if (tryToGrabAction(executor, worker, action)) {
                 executeTask(action);
+                --executor.busy_threads;
             } else {
                 std::this_thread::sleep_for(20ms);
             }
         }
 
-        static auto tryToGrabAction(LazyExecutor &executor, Action &action) -> bool
+        // local queue goes first, jobs of the other nodes are stolen only when it is empty
+        static auto tryToGrabAction(LazyExecutor &executor, Worker const &worker, Action &action)
+            -> bool
         {
-            std::deque<Action> &queue = executor.actions_queue;
-            std::scoped_lock lock{ executor.queue_lock };
+            auto const queues_number = executor.queues.size();
 
-            if (not queue.empty()) {
-                action = queue.front();
-                queue.pop_front();
+            for (size_t i = 0; i != queues_number; ++i) {
+                ActionQueue &queue = executor.queues[(worker.queue_index + i) % queues_number];
+                std::scoped_lock lock{ queue.lock };
 
-                return true;
+                if (queue.tryPop(action)) {
+                    ++executor.busy_threads;
+                    return true;
+                }
             }
 
             return false;
@@ -147,25 +366,146 @@ namespace cerb
 
         static auto executeTask(Action action) -> void
         {
-            action.completion(action.job());
+            if (action.token.isCancelled()) {
+                return;
+            }
+
+            try {
+                action.completion(action.job());
+            } catch (OperationCancelledError const & /*unused*/) {
+                // job has been abandoned by its cancellation token
+            }
+        }
+
+        static auto scalingLoop(std::stop_token const &stop_token, LazyExecutor &executor) -> void
+        {
+            auto last_busy_time = clock::now();
+
+            while (not stop_token.stop_requested()) {
+                std::this_thread::sleep_for(executor.scaling_options.check_period);
+                executor.adjustThreadsNumber(last_busy_time);
+            }
+        }
+
+        auto adjustThreadsNumber(clock::time_point &last_busy_time) -> void
+        {
+            auto const now = clock::now();
+            auto const threads_number = threadsNumber();
+            auto const [queue_is_empty, queue_latency] = getQueueState(now);
+            bool const all_threads_busy = busy_threads >= threads_number;
+
+            if (not queue_is_empty || busy_threads != 0) {
+                last_busy_time = now;
+            }
+
+            if (logicalAnd(
+                    not queue_is_empty, all_threads_busy,
+                    queue_latency > scaling_options.latency_target,
+                    threads_number < scaling_options.max_threads)) {
+                addThread();
+            } else if (logicalAnd(
+                           now - last_busy_time >= scaling_options.idle_period,
+                           threads_number > scaling_options.min_threads)) {
+                removeThread();
+                last_busy_time = now;
+            }
+        }
+
+        auto getQueueState(clock::time_point now) -> std::pair<bool, clock::duration>
+        {
+            bool is_empty = true;
+            auto oldest_enqueue_time = now;
+
+            for (ActionQueue &queue : queues) {
+                std::scoped_lock lock{ queue.lock };
+
+                queue.forEachAction([&is_empty, &oldest_enqueue_time](Action const &action) {
+                    is_empty = false;
+                    oldest_enqueue_time = min(oldest_enqueue_time, action.enqueue_time);
+                });
+            }
+
+            return { is_empty, now - oldest_enqueue_time };
+        }
+
+        auto selectQueue() -> ActionQueue &
+        {
+            if (current_executor == this) {
+                return queues[current_queue_index];
+            }
+
+            return queues[next_queue++ % queues.size()];
+        }
+
+        auto makeWorker(size_t index) const -> Worker
+        {
+            Worker worker{ .index = index };
+
+            if (not placement.cpus.empty()) {
+                u32 cpu = placement.cpus[index % placement.cpus.size()];
+
+                worker.cpus = { cpu };
+                worker.queue_index = topology.findNodeOfCpu(cpu) % queues.size();
+            } else if (placement.numa_aware) {
+                worker.queue_index = index % queues.size();
+                worker.cpus = topology.getNodeCpus(worker.queue_index);
+            }
+
+            return worker;
+        }
+
+        auto applyPlacement(Worker const &worker) const -> void
+        {
+            current_executor = this;
+            current_queue_index = worker.queue_index;
+
+            if (not worker.cpus.empty()) {
+                this_thread::setAffinity(worker.cpus);
+            }
+
+            if (not placement.thread_name.empty()) {
+                this_thread::setName(placement.thread_name + "-" + std::to_string(worker.index));
+            }
+        }
+
+        [[nodiscard]] auto queuesAreEmpty() -> bool
+        {
+            return std::ranges::all_of(queues, [](ActionQueue &queue) {
+                std::scoped_lock lock{ queue.lock };
+                return queue.empty();
+            });
+        }
+
+        auto startScalingController() -> void
+        {
+            scaling_controller = std::jthread(scalingLoop, std::ref(*this));
+        }
+
+        auto stopScalingController() -> void
+        {
+            if (scaling_controller.joinable()) {
+                scaling_controller.request_stop();
+                scaling_controller.join();
+            }
         }
 
         auto waitUntilQueueIsEmpty() -> void
         {
             using namespace std::chrono_literals;
 
-            while (not actions_queue.empty()) {
+            while (not queuesAreEmpty()) {
                 std::this_thread::sleep_for(5ms);
             }
         }
 
         auto restartThreads() -> void
         {
-            auto run_flag = threads_run_flag.begin();
+            std::scoped_lock lock{ threads_lock };
+            auto worker = workers.begin();
 
             for (std::jthread &thread : threads_storage) {
-                thread = std::jthread(threadLoop, std::ref(*this), std::to_address(run_flag));
-                ++run_flag;
+                thread = std::jthread(threadLoop, std::ref(*this), std::ref(*worker));
+                ++worker;
             }
         }
 
@@ -185,11 +525,24 @@ namespace cerb
             // empty function for completion
         }
 
-        std::deque<Action> actions_queue{};
+        // NOLINTBEGIN
+        static inline thread_local LazyExecutor const *current_executor{ nullptr };
+        static inline thread_local size_t current_queue_index{ 0 };
+        // NOLINTEND
+
+        WorkerPlacementOptions placement{};
+        CpuTopology topology{};
+        std::vector<ActionQueue> queues{};
         std::list<std::jthread> threads_storage{};
-        std::list<bool> threads_run_flag;
-        std::mutex queue_lock{};
+        std::list<Worker> workers{};
+        std::jthread scaling_controller{};
+        ElasticScalingOptions scaling_options{};
+        std::atomic<size_t> busy_threads{ 0 };
+        std::atomic<size_t> next_queue{ 0 };
+        std::atomic<size_t> lanes_number{ 2 };
+        std::mutex threads_lock{};
         bool run{ true };
+        bool scaling_enabled{ false };
     };
 }// namespace cerb
 
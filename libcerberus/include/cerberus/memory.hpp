@@ -2,109 +2,399 @@
 #define CERBERUS_MEMORY_HPP
 
 #include <cerberus/bit.hpp>
+#include <cerberus/simd.hpp>
 #include <cerberus/type.hpp>
+#include <compare>
+#include <cstring>
 #include <iterator>
+#include <string>
 
 namespace cerb
 {
 #if CERBLIB_AMD64
     namespace amd64
     {
+        // string instructions are kept as a fallback for processors without simd extensions
+        namespace rep
+        {
+            template<typename T>
+            constexpr auto fill(T *dest, T value, size_t times) -> void
+            {
+                static_assert(
+                    CanBeStoredAsIntegral<T> && std::is_trivially_copy_constructible_v<T>);
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    asm volatile("rep stosb" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    asm volatile("rep stosw" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    asm volatile("rep stosl" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u64)) {
+                    asm volatile("rep stosq" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
+                }
+            }
+
+            template<typename T>
+            constexpr auto copy(T *dest, T const *src, size_t times) -> void
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+
+                if constexpr (sizeof(T) % sizeof(u64) == 0) {
+                    times *= sizeof(T) / sizeof(u64);
+                    asm volatile("rep movsq" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
+                } else if constexpr (sizeof(T) % sizeof(u32) == 0) {
+                    times *= sizeof(T) / sizeof(u32);
+                    asm volatile("rep movsl" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
+                } else if constexpr (sizeof(T) % sizeof(u16) == 0) {
+                    times *= sizeof(T) / sizeof(u16);
+                    asm volatile("rep movsw" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
+                } else {
+                    times *= sizeof(T);
+                    asm volatile("rep movsb" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
+                }
+            }
+
+            template<CanBeStoredAsIntegral T>
+            constexpr auto find(T const *location, T value, size_t limit) -> const T *
+            {
+                ++limit;
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    asm volatile("repnz scasb; adc $-1, %0;"
+                                 : "+D"(location), "+c"(limit)
+                                 : "a"(value)
+                                 : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    asm volatile("repnz scasw; adc $-2, %0;"
+                                 : "+D"(location), "+c"(limit)
+                                 : "a"(value)
+                                 : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    asm volatile("repnz scasl; adc $-4, %0;"
+                                 : "+D"(location), "+c"(limit)
+                                 : "a"(value)
+                                 : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u64)) {
+                    asm volatile("repnz scasq; adc $-4, %0;"
+                                 : "+D"(location), "+c"(limit)
+                                 : "a"(value)
+                                 : "memory");
+                }
+
+                return location;
+            }
+
+            template<typename T>
+            constexpr auto memcmp(T const *dest, T const *src, size_t length) -> bool
+            {
+                ++length;
+
+                if constexpr (sizeof(T) % sizeof(u64) == 0) {
+                    length *= sizeof(T) / sizeof(u64);
+                    asm volatile("repe cmpsq; shr $3, %2;"
+                                 : "+D"(dest), "+S"(src), "+c"(length)
+                                 :
+                                 : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    length *= sizeof(T) / sizeof(u32);
+                    asm volatile("repe cmpsl; shr $2, %2;"
+                                 : "+D"(dest), "+S"(src), "+c"(length)
+                                 :
+                                 : "memory");
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    length *= sizeof(T) / sizeof(u16);
+                    asm volatile("repe cmpsw; shr $1, %2;"
+                                 : "+D"(dest), "+S"(src), "+c"(length)
+                                 :
+                                 : "memory");
+                } else {
+                    length *= sizeof(T);
+                    asm volatile("repe cmpsb;" : "+D"(dest), "+S"(src), "+c"(length) : : "memory");
+                }
+
+                return length == 0;
+            }
+        }// namespace rep
+
+        // small fills and copies go to the standard library, the kernels stream large buffers
         template<typename T>
-        constexpr auto fill(T *dest, T value, size_t times) -> void
+        auto fill(T *dest, T value, size_t times) -> void
         {
-            static_assert(CanBeStoredAsIntegral<T> && std::is_trivially_copy_constructible_v<T>);
+#    if CERBLIB_SIMD
+            if (times * sizeof(T) < LargeBufferThreshold) {
+                return std::fill(dest, dest + times, value);
+            }
 
-            if constexpr (sizeof(T) == sizeof(u8)) {
-                asm volatile("rep stosb" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u16)) {
-                asm volatile("rep stosw" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u32)) {
-                asm volatile("rep stosl" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u64)) {
-                asm volatile("rep stosq" : "+D"(dest), "+c"(times) : "a"(value) : "memory");
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::fill(dest, value, times);
+
+            case SimdLevel::AVX2:
+                return avx2::fill(dest, value, times);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::fill(dest, value, times);
+
+            default:
+                break;
             }
+#    endif /* CERBLIB_SIMD */
+
+            rep::fill(dest, value, times);
         }
 
         template<typename T>
-        constexpr auto copy(T *dest, T const *src, size_t times) -> void
+        auto copy(T *dest, T const *src, size_t times) -> void
         {
-            static_assert(std::is_trivially_copyable_v<T>);
+#    if CERBLIB_SIMD
+            auto const bytes = times * sizeof(T);
+            auto const out = std::bit_cast<uintptr_t>(dest);
+            auto const in = std::bit_cast<uintptr_t>(src);
 
-            if constexpr (sizeof(T) % sizeof(u64) == 0) {
-                times *= sizeof(T) / sizeof(u64);
-                asm volatile("rep movsq" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
-            } else if constexpr (sizeof(T) % sizeof(u32) == 0) {
-                times *= sizeof(T) / sizeof(u32);
-                asm volatile("rep movsl" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
-            } else if constexpr (sizeof(T) % sizeof(u16) == 0) {
-                times *= sizeof(T) / sizeof(u16);
-                asm volatile("rep movsw" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
-            } else {
-                times *= sizeof(T);
-                asm volatile("rep movsb" : "+D"(dest), "+S"(src), "+c"(times) : : "memory");
+            if (bytes < LargeBufferThreshold) {
+                return static_cast<void>(std::copy(src, src + times, dest));
             }
+
+            // kernels copy blocks of memory, so they are used only when ranges do not overlap
+            if (out + bytes <= in || in + bytes <= out) {
+                switch (getSimdLevel()) {
+                case SimdLevel::AVX512:
+                    return avx512::copy(dest, src, bytes);
+
+                case SimdLevel::AVX2:
+                    return avx2::copy(dest, src, bytes);
+
+                case SimdLevel::SSE42:
+                case SimdLevel::SSE2:
+                    return sse2::copy(dest, src, bytes);
+
+                default:
+                    break;
+                }
+            }
+#    endif /* CERBLIB_SIMD */
+
+            rep::copy(dest, src, times);
         }
 
+        // memchr is faster than the kernels for bytes, the kernels are used for wider chars
         template<CanBeStoredAsIntegral T>
-        constexpr auto find(T const *location, T value, size_t limit) -> const T *
+        auto find(T const *location, T value, size_t limit) -> T const *
         {
-            ++limit;
+            if (limit == 0) {
+                return location;
+            }
 
             if constexpr (sizeof(T) == sizeof(u8)) {
-                asm volatile("repnz scasb; adc $-1, %0;"
-                             : "+D"(location), "+c"(limit)
-                             : "a"(value)
-                             : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u16)) {
-                asm volatile("repnz scasw; adc $-2, %0;"
-                             : "+D"(location), "+c"(limit)
-                             : "a"(value)
-                             : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u32)) {
-                asm volatile("repnz scasl; adc $-4, %0;"
-                             : "+D"(location), "+c"(limit)
-                             : "a"(value)
-                             : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u64)) {
-                asm volatile("repnz scasq; adc $-4, %0;"
-                             : "+D"(location), "+c"(limit)
-                             : "a"(value)
-                             : "memory");
+                auto const *found = std::memchr(location, std::bit_cast<u8>(value), limit);
+                return found == nullptr ? location + limit : static_cast<T const *>(found);
             }
 
-            return location;
+#    if CERBLIB_SIMD
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::find(location, value, limit);
+
+            case SimdLevel::AVX2:
+                return avx2::find(location, value, limit);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::find(location, value, limit);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return rep::find(location, value, limit);
         }
 
+        // memcmp is faster than the vector kernels on every size
         template<typename T>
-        constexpr auto memcmp(T const *dest, T const *src, size_t length) -> bool
+        auto memcmp(T const *dest, T const *src, size_t length) -> bool
         {
-            ++length;
-
-            if constexpr (sizeof(T) % sizeof(u64) == 0) {
-                length *= sizeof(T) / sizeof(u64);
-                asm volatile("repe cmpsq; shr $3, %2;"
-                             : "+D"(dest), "+S"(src), "+c"(length)
-                             :
-                             : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u32)) {
-                length *= sizeof(T) / sizeof(u32);
-                asm volatile("repe cmpsl; shr $2, %2;"
-                             : "+D"(dest), "+S"(src), "+c"(length)
-                             :
-                             : "memory");
-            } else if constexpr (sizeof(T) == sizeof(u16)) {
-                length *= sizeof(T) / sizeof(u16);
-                asm volatile("repe cmpsw; shr $1, %2;"
-                             : "+D"(dest), "+S"(src), "+c"(length)
-                             :
-                             : "memory");
-            } else {
-                length *= sizeof(T);
-                asm volatile("repe cmpsb;" : "+D"(dest), "+S"(src), "+c"(length) : : "memory");
-            }
-
-            return length == 0;
+            if (length == 0) {
+                return true;
+            }
+
+#    if CERBLIB_SIMD
+            static_assert(std::is_trivially_copyable_v<T>);
+            return std::memcmp(dest, src, length * sizeof(T)) == 0;
+#    else
+            return rep::memcmp(dest, src, length);
+#    endif /* CERBLIB_SIMD */
+        }
+
+        template<typename T>
+        auto mismatch(T const *lhs, T const *rhs, size_t length) -> size_t
+        {
+#    if CERBLIB_SIMD
+            auto const bytes = length * sizeof(T);
+
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::mismatch(lhs, rhs, bytes) / sizeof(T);
+
+            case SimdLevel::AVX2:
+                return avx2::mismatch(lhs, rhs, bytes) / sizeof(T);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::mismatch(lhs, rhs, bytes) / sizeof(T);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return static_cast<size_t>(std::mismatch(lhs, lhs + length, rhs).first - lhs);
+        }
+
+        template<typename T>
+        auto search(T const *location, size_t limit, T const *needle, size_t needle_length)
+            -> T const *
+        {
+#    if CERBLIB_SIMD
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::search(location, limit, needle, needle_length);
+
+            case SimdLevel::AVX2:
+                return avx2::search(location, limit, needle, needle_length);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::search(location, limit, needle, needle_length);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return cerb::private_::searchScalar(location, limit, needle, needle_length);
+        }
+
+        template<typename T>
+        auto rsearch(T const *location, size_t limit, T const *needle, size_t needle_length)
+            -> T const *
+        {
+#    if CERBLIB_SIMD
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::rsearch(location, limit, needle, needle_length);
+
+            case SimdLevel::AVX2:
+                return avx2::rsearch(location, limit, needle, needle_length);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::rsearch(location, limit, needle, needle_length);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return cerb::private_::rsearchScalar(location, limit, needle, needle_length);
+        }
+
+        template<BitwiseOperation Operation, std::unsigned_integral T>
+        auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+        {
+#    if CERBLIB_SIMD
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::bitwiseApply<Operation>(dest, src, length);
+
+            case SimdLevel::AVX2:
+                return avx2::bitwiseApply<Operation>(dest, src, length);
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                return sse2::bitwiseApply<Operation>(dest, src, length);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            cerb::private_::bitwiseApplyScalar<Operation>(dest, src, length);
+        }
+
+        template<std::unsigned_integral T>
+        auto popCount(T const *location, size_t length) -> size_t
+        {
+#    if CERBLIB_SIMD
+            if (getSimdLevel() >= SimdLevel::SSE42) {
+                return sse42::popCount(location, length);
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return cerb::private_::popCountScalar(location, length);
+        }
+
+        template<bit::ValueOfBit... BitValues, size_t Length>
+        auto findMaskedWord(std::array<size_t, Length> const *axes, size_t from) -> size_t
+        {
+#    if CERBLIB_SIMD
+            if (getSimdLevel() >= SimdLevel::AVX2) {
+                return avx2::findMaskedWord<BitValues...>(axes, from);
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return cerb::private_::findMaskedWordScalar<BitValues...>(axes, from);
+        }
+
+        template<std::integral T>
+        auto findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+            -> T const *
+        {
+#    if CERBLIB_SIMD
+            switch (getSimdLevel()) {
+            case SimdLevel::AVX512:
+                return avx512::findAnyOf(location, limit, needles, needles_count);
+
+            case SimdLevel::AVX2:
+                return avx2::findAnyOf(location, limit, needles, needles_count);
+
+            case SimdLevel::SSE42:
+                return sse42::findAnyOf(location, limit, needles, needles_count);
+
+            case SimdLevel::SSE2:
+                return sse2::findAnyOf(location, limit, needles, needles_count);
+
+            default:
+                break;
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return std::find_first_of(location, location + limit, needles, needles + needles_count);
+        }
+
+        template<std::integral T>
+        auto findClass(T const *location, size_t limit, CharClass const &char_class) -> T const *
+        {
+#    if CERBLIB_SIMD
+            if constexpr (sizeof(T) == sizeof(u8)) {
+                switch (getSimdLevel()) {
+                case SimdLevel::AVX512:
+                case SimdLevel::AVX2:
+                    return avx2::findClass(location, limit, char_class);
+
+                case SimdLevel::SSE42:
+                    return sse42::findClass(location, limit, char_class);
+
+                default:
+                    break;
+                }
+            }
+#    endif /* CERBLIB_SIMD */
+
+            return std::find_if(location, location + limit, [&char_class](T chr) {
+                return char_class.contains(chr);
+            });
         }
     }// namespace amd64
 #endif
@@ -120,6 +410,12 @@ namespace cerb
         template<CharacterLiteral CharT>
         CERBLIB_DECL auto strlenForPointer(CharT const *str) -> size_t
         {
+            // vectorized search could read past the terminator, so the length of the string is
+            // left to the standard library at runtime
+            if CERBLIB_RUNTIME {
+                return std::char_traits<CharT>::length(str);
+            }
+
             constexpr auto max_length = std::numeric_limits<u32>::max();
 
             auto terminator_iterator = find(str, static_cast<CharT>(0), max_length);
@@ -194,7 +490,7 @@ namespace cerb
         if constexpr (suitable_for_fast_copy) {
             if CERBLIB_RUNTIME {
                 auto const length = min<GetSizeType<T1>>(std::size(dest), std::size(src));
-                return amd64::copy(std::data(dest), std::size(src), length);
+                return amd64::copy(std::data(dest), std::data(src), length);
             }
         }
 #endif
@@ -234,6 +530,119 @@ namespace cerb
         return std::ranges::find(iterable_class, value_to_find);
     }
 
+    template<typename T>
+    CERBLIB_DECL auto
+        findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+            -> T const *
+    {
+#if CERBLIB_AMD64
+        if constexpr (std::integral<T>) {
+            if CERBLIB_RUNTIME {
+                return amd64::findAnyOf(location, limit, needles, needles_count);
+            }
+        }
+#endif
+        return std::find_first_of(location, location + limit, needles, needles + needles_count);
+    }
+
+    template<std::integral T>
+    CERBLIB_DECL auto findClass(T const *location, size_t limit, CharClass const &char_class)
+        -> T const *
+    {
+#if CERBLIB_AMD64
+        if CERBLIB_RUNTIME {
+            return amd64::findClass(location, limit, char_class);
+        }
+#endif
+        return std::find_if(location, location + limit, [&char_class](T chr) {
+            return char_class.contains(chr);
+        });
+    }
+
+    // dest[i] = dest[i] <Operation> src[i] for each i in [0, length)
+    template<BitwiseOperation Operation, std::unsigned_integral T>
+    constexpr auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+    {
+#if CERBLIB_AMD64
+        if CERBLIB_RUNTIME {
+            return amd64::bitwiseApply<Operation>(dest, src, length);
+        }
+#endif
+        private_::bitwiseApplyScalar<Operation>(dest, src, length);
+    }
+
+    template<std::unsigned_integral T>
+    CERBLIB_DECL auto popCount(T const *location, size_t length) -> size_t
+    {
+#if CERBLIB_AMD64
+        if CERBLIB_RUNTIME {
+            return amd64::popCount(location, length);
+        }
+#endif
+        return private_::popCountScalar(location, length);
+    }
+
+    // index of the first word at or after from, which has a bit with the given value on every
+    // axis, or Length if there is none
+    template<bit::ValueOfBit... BitValues, size_t Length>
+    CERBLIB_DECL auto findMaskedWord(std::array<size_t, Length> const *axes, size_t from)
+        -> size_t
+    {
+#if CERBLIB_AMD64
+        if CERBLIB_RUNTIME {
+            return amd64::findMaskedWord<BitValues...>(axes, from);
+        }
+#endif
+        return private_::findMaskedWordScalar<BitValues...>(axes, from);
+    }
+
+    // returns pointer to the first occurrence of the needle or location + limit, if there is none
+    template<typename T>
+    CERBLIB_DECL auto search(T const *location, size_t limit, T const *needle, size_t needle_length)
+        -> T const *
+    {
+        if (needle_length == 0) {
+            return location;
+        }
+
+        if (needle_length > limit) {
+            return location + limit;
+        }
+
+#if CERBLIB_AMD64
+        constexpr bool suitable_for_fast_search = CanBeStoredAsIntegral<T> && std::is_trivial_v<T>;
+
+        if constexpr (suitable_for_fast_search) {
+            if CERBLIB_RUNTIME {
+                return amd64::search(location, limit, needle, needle_length);
+            }
+        }
+#endif
+        return private_::searchScalar(location, limit, needle, needle_length);
+    }
+
+    // returns pointer to the last occurrence of the needle or location + limit, if there is none
+    template<typename T>
+    CERBLIB_DECL auto
+        rsearch(T const *location, size_t limit, T const *needle, size_t needle_length)
+            -> T const *
+    {
+        if (logicalOr(needle_length == 0, needle_length > limit)) {
+            return location + limit;
+        }
+
+#if CERBLIB_AMD64
+        constexpr bool suitable_for_fast_search = CanBeStoredAsIntegral<T> && std::is_trivial_v<T>;
+
+        if constexpr (suitable_for_fast_search) {
+            if CERBLIB_RUNTIME {
+                return amd64::rsearch(location, limit, needle, needle_length);
+            }
+        }
+#endif
+        return private_::rsearchScalar(location, limit, needle, needle_length);
+    }
+
     template<Iterable T>
     CERBLIB_DECL auto rfind(T &iterable_class, GetValueType<T> value_to_find) ->
         typename T::reverse_iterator
@@ -287,6 +696,36 @@ namespace cerb
         return std::equal(lhs, lhs + length, rhs, rhs + length);
     }
 
+    // returns index of the first mismatching element or length, if ranges are equal
+    template<typename T>
+    CERBLIB_DECL auto mismatch(T const *lhs, T const *rhs, size_t length) -> size_t
+    {
+#if CERBLIB_AMD64
+        constexpr bool can_be_fast_compared = CanBeStoredAsIntegral<T> && std::is_trivial_v<T>;
+
+        if constexpr (can_be_fast_compared) {
+            if CERBLIB_RUNTIME {
+                return amd64::mismatch(lhs, rhs, length);
+            }
+        }
+#endif
+        return static_cast<size_t>(std::mismatch(lhs, lhs + length, rhs).first - lhs);
+    }
+
+    template<typename T>
+    CERBLIB_DECL auto compare(T const *lhs, size_t lhs_length, T const *rhs, size_t rhs_length)
+        -> std::compare_three_way_result_t<T>
+    {
+        auto const common_length = min(lhs_length, rhs_length);
+        auto const index = mismatch(lhs, rhs, common_length);
+
+        if (index != common_length) {
+            return std::compare_three_way{}(lhs[index], rhs[index]);
+        }
+
+        return std::compare_three_way{}(lhs_length, rhs_length);
+    }
+
     template<typename T>
     CERBLIB_DECL auto ptrdiff(T first, T last) -> size_t
     {
@@ -53,24 +53,31 @@ namespace cerb
             return static_cast<U *>(pointer);
         }
 
-        CERBLIB_DECL auto operator==(RawPointerWrapper const &other) -> bool
+        CERBLIB_DECL auto operator==(RawPointerWrapper const &other) const -> bool
         {
             return equal(*this, other);
         }
 
         template<Iterable U>
-        CERBLIB_DECL auto operator<=>(U const &other) -> decltype(auto)
+        CERBLIB_DECL auto operator<=>(U const &other) const -> decltype(auto)
         {
-            auto checking_length = min<size_t>(size(), other.size());
+            constexpr bool can_be_fast_compared =
+                RawAccessible<U> && std::is_same_v<std::remove_cv_t<T>, GetValueType<U>>;
 
-            CERBLIB_UNROLL_N(4)
-            for (size_t i = 0; i != checking_length; ++i) {
-                if (*(pointer + i) != other[i]) {
-                    return *(pointer + i) <=> other[i];
+            if constexpr (can_be_fast_compared) {
+                return compare(pointer, length, std::data(other), std::size(other));
+            } else {
+                auto checking_length = min<size_t>(size(), other.size());
+
+                CERBLIB_UNROLL_N(4)
+                for (size_t i = 0; i != checking_length; ++i) {
+                    if (*(pointer + i) != other[i]) {
+                        return *(pointer + i) <=> other[i];
+                    }
                 }
-            }
 
-            return size() <=> other.size();
+                return size() <=> other.size();
+            }
         }
 
         CERBLIB_DECL auto begin() -> iterator
@@ -0,0 +1,113 @@
+#ifndef CERBERUS_SEARCHER_HPP
+#define CERBERUS_SEARCHER_HPP
+
+#include <cerberus/string_view.hpp>
+
+namespace cerb
+{
+    // Substring searcher for a needle, which is looked up many times. Kernels are selected once
+    // at construction, so that each search goes straight to the vectorized loop.
+    template<CharacterLiteral CharT>
+    class Searcher
+    {
+        using kernel_t = CharT const *(*)(CharT const *, size_t, CharT const *, size_t);
+
+    public:
+        constexpr static size_t npos = BasicStringView<CharT>::npos;
+
+        CERBLIB_DECL auto getNeedle() const -> BasicStringView<CharT> const &
+        {
+            return needle;
+        }
+
+        CERBLIB_DECL auto find(BasicStringView<CharT> const &text, size_t position = 0) const
+            -> size_t
+        {
+            if (position + needle.size() > text.size()) {
+                return npos;
+            }
+
+            if (needle.empty()) {
+                return position;
+            }
+
+            auto const *found = searchIn(text.begin() + position, text.size() - position);
+            return found == text.end() ? npos : ptrdiff(text.begin(), found);
+        }
+
+        CERBLIB_DECL auto rfind(BasicStringView<CharT> const &text) const -> size_t
+        {
+            if (needle.size() > text.size()) {
+                return npos;
+            }
+
+            if (needle.empty()) {
+                return text.size();
+            }
+
+            auto const *found = rsearchIn(text.begin(), text.size());
+            return found == text.end() ? npos : ptrdiff(text.begin(), found);
+        }
+
+        Searcher() = default;
+
+        constexpr explicit Searcher(BasicStringView<CharT> const &needle_to_search)
+          : needle(needle_to_search)
+        {
+            if CERBLIB_RUNTIME {
+                selectKernels();
+            }
+        }
+
+    private:
+        CERBLIB_DECL auto searchIn(CharT const *location, size_t limit) const -> CharT const *
+        {
+            if (search_kernel != nullptr) {
+                return search_kernel(location, limit, needle.data(), needle.size());
+            }
+
+            return cerb::search(location, limit, needle.data(), needle.size());
+        }
+
+        CERBLIB_DECL auto rsearchIn(CharT const *location, size_t limit) const -> CharT const *
+        {
+            if (rsearch_kernel != nullptr) {
+                return rsearch_kernel(location, limit, needle.data(), needle.size());
+            }
+
+            return cerb::rsearch(location, limit, needle.data(), needle.size());
+        }
+
+        auto selectKernels() -> void
+        {
+#if CERBLIB_SIMD
+            switch (amd64::getSimdLevel()) {
+            case SimdLevel::AVX512:
+                search_kernel = amd64::avx512::search<CharT>;
+                rsearch_kernel = amd64::avx512::rsearch<CharT>;
+                break;
+
+            case SimdLevel::AVX2:
+                search_kernel = amd64::avx2::search<CharT>;
+                rsearch_kernel = amd64::avx2::rsearch<CharT>;
+                break;
+
+            case SimdLevel::SSE42:
+            case SimdLevel::SSE2:
+                search_kernel = amd64::sse2::search<CharT>;
+                rsearch_kernel = amd64::sse2::rsearch<CharT>;
+                break;
+
+            default:
+                break;
+            }
+#endif /* CERBLIB_SIMD */
+        }
+
+        BasicStringView<CharT> needle{};
+        kernel_t search_kernel{ nullptr };
+        kernel_t rsearch_kernel{ nullptr };
+    };
+}// namespace cerb
+
+#endif /* CERBERUS_SEARCHER_HPP */
@@ -0,0 +1,1428 @@
+#ifndef CERBERUS_SIMD_HPP
+#define CERBERUS_SIMD_HPP
+
+#include <cerberus/bit_manipulation.hpp>
+#include <cerberus/char_class.hpp>
+#include <cerberus/number.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if CERBLIB_SIMD
+#    include <immintrin.h>
+#endif /* CERBLIB_SIMD */
+
+namespace cerb
+{
+    enum struct SimdLevel : u8
+    {
+        NONE,
+        SSE2,
+        SSE42,
+        AVX2,
+        AVX512
+    };
+
+    // fills and copies of that size would evict the whole cache anyway,
+    // so they are done with non-temporal stores
+    constexpr size_t NonTemporalThreshold = 1024UL * 1024UL;
+
+    // below that size the standard library fills and copies faster than the kernels
+    // (see libcerberus/benchmark/memory.cpp)
+    constexpr size_t LargeBufferThreshold = 32UL * 1024UL * 1024UL;
+
+    // multi-needle search compares each block with every needle, larger sets of bytes are
+    // searched as a CharClass
+    constexpr size_t MaxBroadcastNeedles = 16;
+
+    // ANDNOT clears bits of the destination, which are set in the source
+    enum struct BitwiseOperation : u8
+    {
+        AND,
+        OR,
+        XOR,
+        ANDNOT
+    };
+
+    namespace private_
+    {
+        template<BitwiseOperation Operation, std::unsigned_integral T>
+        CERBLIB_DECL auto applyBitwise(T dest, T src) -> T
+        {
+            if constexpr (Operation == BitwiseOperation::AND) {
+                return dest & src;
+            } else if constexpr (Operation == BitwiseOperation::OR) {
+                return dest | src;
+            } else if constexpr (Operation == BitwiseOperation::XOR) {
+                return dest ^ src;
+            } else {
+                return dest & static_cast<T>(~src);
+            }
+        }
+
+        template<BitwiseOperation Operation, std::unsigned_integral T>
+        constexpr auto bitwiseApplyScalar(T *dest, T const *src, size_t length) -> void
+        {
+            for (size_t i = 0; i != length; ++i) {
+                dest[i] = applyBitwise<Operation>(dest[i], src[i]);
+            }
+        }
+
+        // index of the first word at or after from, which has a bit with the given value on every
+        // axis, or Length if there is none
+        template<bit::ValueOfBit... BitValues, size_t Length>
+        CERBLIB_DECL auto findMaskedWordScalar(std::array<size_t, Length> const *axes, size_t from)
+            -> size_t
+        {
+            for (; from < Length; ++from) {
+                if (bit::applyMaskOnArray<size_t, decltype(axes), BitValues...>(from, axes) != 0) {
+                    return from;
+                }
+            }
+
+            return Length;
+        }
+
+        template<std::unsigned_integral T>
+        constexpr auto popCountScalar(T const *location, size_t length) -> size_t
+        {
+            size_t result = 0;
+
+            for (size_t i = 0; i != length; ++i) {
+                result += static_cast<size_t>(std::popcount(location[i]));
+            }
+
+            return result;
+        }
+
+        // first and last elements of the needle are checked before the rest of it,
+        // needle_length must be in range [1, limit]
+        template<typename T>
+        constexpr auto isNeedleAt(T const *location, T const *needle, size_t needle_length) -> bool
+        {
+            auto const last = needle_length - 1;
+
+            if (logicalOr(location[0] != needle[0], location[last] != needle[last])) {
+                return false;
+            }
+
+            return needle_length <= 2 ||
+                   std::equal(needle + 1, needle + needle_length - 1, location + 1);
+        }
+
+        template<typename T>
+        constexpr auto searchScalar(
+            T const *location, size_t limit, T const *needle, size_t needle_length) -> T const *
+        {
+            auto const candidates = limit - needle_length + 1;
+
+            for (size_t index = 0; index != candidates; ++index) {
+                if (isNeedleAt(location + index, needle, needle_length)) {
+                    return location + index;
+                }
+            }
+
+            return location + limit;
+        }
+
+        template<typename T>
+        constexpr auto rsearchScalar(
+            T const *location, size_t limit, T const *needle, size_t needle_length) -> T const *
+        {
+            for (size_t index = limit - needle_length + 1; index != 0; --index) {
+                if (isNeedleAt(location + index - 1, needle, needle_length)) {
+                    return location + index - 1;
+                }
+            }
+
+            return location + limit;
+        }
+    }// namespace private_
+
+#if CERBLIB_SIMD
+    namespace amd64
+    {
+        inline auto detectSimdLevel() -> SimdLevel
+        {
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+                return SimdLevel::AVX512;
+            }
+
+            if (__builtin_cpu_supports("avx2")) {
+                return SimdLevel::AVX2;
+            }
+
+            if (__builtin_cpu_supports("sse4.2")) {
+                return SimdLevel::SSE42;
+            }
+
+            return SimdLevel::SSE2;
+        }
+
+        inline auto getSimdLevel() -> SimdLevel
+        {
+            static SimdLevel const simd_level = detectSimdLevel();
+            return simd_level;
+        }
+
+        namespace private_
+        {
+            template<typename T>
+            CERBLIB_DECL auto asSignedIntegral(T value)
+            {
+                if constexpr (sizeof(T) == sizeof(i8)) {
+                    return std::bit_cast<i8>(value);
+                } else if constexpr (sizeof(T) == sizeof(i16)) {
+                    return std::bit_cast<i16>(value);
+                } else if constexpr (sizeof(T) == sizeof(i32)) {
+                    return std::bit_cast<i32>(value);
+                } else {
+                    return std::bit_cast<i64>(value);
+                }
+            }
+
+            CERBLIB_DECL auto misalignment(void const *pointer, size_t alignment) -> size_t
+            {
+                return std::bit_cast<uintptr_t>(pointer) % alignment;
+            }
+
+            // byte masks of sse2 and avx2 have all bits of a matched element set,
+            // so only the lowest bit of each element is kept to visit every element once
+            template<size_t ElementSize>
+            constexpr u32 element_start_bits = ElementSize == sizeof(u8)    ? 0xFFFF'FFFFU
+                                               : ElementSize == sizeof(u16) ? 0x5555'5555U
+                                               : ElementSize == sizeof(u32) ? 0x1111'1111U
+                                                                            : 0x0101'0101U;
+
+            template<std::unsigned_integral UInt>
+            CERBLIB_DECL auto highestBit(UInt value) -> size_t
+            {
+                return bitsizeof(UInt) - 1 - static_cast<size_t>(std::countl_zero(value));
+            }
+
+            inline auto mismatchBytes(u8 const *lhs, u8 const *rhs, size_t bytes) -> size_t
+            {
+                return static_cast<size_t>(std::mismatch(lhs, lhs + bytes, rhs).first - lhs);
+            }
+
+            template<std::integral T>
+            auto findClassScalar(T const *location, size_t limit, CharClass const &char_class)
+                -> T const *
+            {
+                return std::find_if(location, location + limit, [&char_class](T chr) {
+                    return char_class.contains(chr);
+                });
+            }
+
+            template<std::integral T>
+            auto makeCharClass(T const *needles, size_t needles_count) -> CharClass
+            {
+                CharClass char_class{};
+
+                for (size_t i = 0; i != needles_count; ++i) {
+                    char_class.add(needles[i]);
+                }
+
+                return char_class;
+            }
+
+            template<std::integral T>
+            auto findAnyOfScalar(
+                T const *location, size_t limit, T const *needles, size_t needles_count)
+                -> T const *
+            {
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    if (needles_count > MaxBroadcastNeedles) {
+                        auto const char_class = makeCharClass(needles, needles_count);
+                        return findClassScalar(location, limit, char_class);
+                    }
+                }
+
+                return std::find_first_of(
+                    location, location + limit, needles, needles + needles_count);
+            }
+        }// namespace private_
+
+        namespace sse2
+        {
+            constexpr size_t width = sizeof(__m128i);
+
+            inline auto load(void const *location) -> __m128i
+            {
+                return _mm_loadu_si128(static_cast<__m128i const *>(location));
+            }
+
+            inline auto store(void *location, __m128i value) -> void
+            {
+                _mm_storeu_si128(static_cast<__m128i *>(location), value);
+            }
+
+            inline auto stream(void *location, __m128i value) -> void
+            {
+                _mm_stream_si128(static_cast<__m128i *>(location), value);
+            }
+
+            template<typename T>
+            inline auto broadcast(T value) -> __m128i
+            {
+                auto const bits = private_::asSignedIntegral(value);
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    return _mm_set1_epi8(bits);
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    return _mm_set1_epi16(bits);
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    return _mm_set1_epi32(bits);
+                } else {
+                    return _mm_set1_epi64x(bits);
+                }
+            }
+
+            // returns a byte mask, where all bytes of the matched elements are set
+            template<size_t ElementSize>
+            inline auto matchMask(__m128i lhs, __m128i rhs) -> u32
+            {
+                if constexpr (ElementSize == sizeof(u8)) {
+                    return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+                } else if constexpr (ElementSize == sizeof(u16)) {
+                    return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi16(lhs, rhs)));
+                } else if constexpr (ElementSize == sizeof(u32)) {
+                    return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)));
+                } else {
+                    // sse2 has no 64-bit comparison, so both halves of an element must match
+                    auto mask = static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)));
+                    return mask & (mask >> 4U) & 0x0F0FU;
+                }
+            }
+
+            inline auto storeRepeated(u8 *dest, __m128i pattern, size_t bytes, bool non_temporal)
+                -> void
+            {
+                size_t offset = 0;
+
+                if (non_temporal) {
+                    store(dest, pattern);
+                    offset = (width - private_::misalignment(dest, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(dest + offset, pattern);
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(dest + offset, pattern);
+                }
+
+                if (offset != bytes) {
+                    store(dest + bytes - width, pattern);
+                }
+            }
+
+            template<typename T>
+            auto fill(T *dest, T value, size_t times) -> void
+            {
+                auto const bytes = times * sizeof(T);
+
+                if (bytes < width) {
+                    return std::fill(dest, dest + times, value);
+                }
+
+                auto const non_temporal = logicalAnd(
+                    bytes >= NonTemporalThreshold, private_::misalignment(dest, sizeof(T)) == 0);
+
+                storeRepeated(static_cast<u8 *>(static_cast<void *>(dest)), broadcast(value),
+                              bytes, non_temporal);
+            }
+
+            inline auto copy(void *dest, void const *src, size_t bytes) -> void
+            {
+                auto *out = static_cast<u8 *>(dest);
+                auto const *in = static_cast<u8 const *>(src);
+
+                if (bytes < width) {
+                    std::copy(in, in + bytes, out);
+                    return;
+                }
+
+                auto const tail = load(in + bytes - width);
+                size_t offset = 0;
+
+                if (bytes >= NonTemporalThreshold) {
+                    store(out, load(in));
+                    offset = (width - private_::misalignment(out, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(out + offset, load(in + offset));
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(out + offset, load(in + offset));
+                }
+
+                store(out + bytes - width, tail);
+            }
+
+            template<typename T>
+            auto find(T const *location, T value, size_t limit) -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if (limit < step) {
+                    return std::find(location, location + limit, value);
+                }
+
+                auto const pattern = broadcast(value);
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+                    auto mask = matchMask<sizeof(T)>(load(location + index), pattern);
+
+                    if (mask != 0) {
+                        auto match_index = static_cast<size_t>(std::countr_zero(mask)) / sizeof(T);
+                        return location + index + match_index;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // returns offset of the first mismatching byte or bytes, if memory is equal
+            inline auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+            {
+                constexpr u32 all_bytes_match = 0xFFFFU;
+
+                auto const *first = static_cast<u8 const *>(lhs);
+                auto const *second = static_cast<u8 const *>(rhs);
+
+                if (bytes < width) {
+                    return private_::mismatchBytes(first, second, bytes);
+                }
+
+                for (size_t offset = 0; offset != bytes; offset += width) {
+                    offset = min(offset, bytes - width);
+
+                    auto mask = matchMask<1>(load(first + offset), load(second + offset));
+
+                    if (mask != all_bytes_match) {
+                        return offset + static_cast<size_t>(std::countr_one(mask));
+                    }
+                }
+
+                return bytes;
+            }
+
+            template<std::integral T>
+            auto findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if (logicalOr(limit < step, needles_count > MaxBroadcastNeedles)) {
+                    return private_::findAnyOfScalar(location, limit, needles, needles_count);
+                }
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+
+                    auto const chunk = load(location + index);
+                    u32 mask = 0;
+
+                    for (size_t i = 0; i != needles_count; ++i) {
+                        mask |= matchMask<sizeof(T)>(chunk, broadcast(needles[i]));
+                    }
+
+                    if (mask != 0) {
+                        auto match_index = static_cast<size_t>(std::countr_zero(mask)) / sizeof(T);
+                        return location + index + match_index;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // marks elements, which are equal to the head and are followed by the tail
+            // at tail_offset bytes
+            template<size_t ElementSize>
+            inline auto candidateMask(
+                void const *location, size_t tail_offset, __m128i head, __m128i tail) -> u32
+            {
+                auto const *bytes = static_cast<u8 const *>(location);
+
+                return matchMask<ElementSize>(load(bytes), head) &
+                       matchMask<ElementSize>(load(bytes + tail_offset), tail) &
+                       private_::element_start_bits<ElementSize>;
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            auto search(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return cerb::private_::searchScalar(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t index = 0; index != candidates; index += step) {
+                    index = min(index, candidates - step);
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    for (; mask != 0; mask &= mask - 1) {
+                        auto const match_index = static_cast<size_t>(std::countr_zero(mask));
+                        auto const *candidate = location + index + match_index / sizeof(T);
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            auto rsearch(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return cerb::private_::rsearchScalar(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t processed = 0; processed != candidates; processed += step) {
+                    processed = min(processed, candidates - step);
+                    auto const index = candidates - step - processed;
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    while (mask != 0) {
+                        auto const bit = private_::highestBit(mask);
+                        auto const *candidate = location + index + bit / sizeof(T);
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+
+                        mask ^= static_cast<u32>(1) << bit;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            template<BitwiseOperation Operation>
+            inline auto applyBitwise(__m128i dest, __m128i src) -> __m128i
+            {
+                if constexpr (Operation == BitwiseOperation::AND) {
+                    return _mm_and_si128(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::OR) {
+                    return _mm_or_si128(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::XOR) {
+                    return _mm_xor_si128(dest, src);
+                } else {
+                    return _mm_andnot_si128(src, dest);
+                }
+            }
+
+            template<BitwiseOperation Operation, std::unsigned_integral T>
+            auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+            {
+                constexpr size_t step = width / sizeof(T);
+                size_t index = 0;
+
+                for (; index + step <= length; index += step) {
+                    auto const lhs = load(dest + index);
+                    store(dest + index, applyBitwise<Operation>(lhs, load(src + index)));
+                }
+
+                auto const rest = length - index;
+                cerb::private_::bitwiseApplyScalar<Operation>(dest + index, src + index, rest);
+            }
+        }// namespace sse2
+
+        namespace sse42
+        {
+            constexpr size_t width = sizeof(__m128i);
+
+            CERBLIB_TARGET("sse4.2")
+            inline auto classMask(__m128i chunk, __m128i low_table, __m128i high_table) -> u32
+            {
+                auto const nibble_mask = _mm_set1_epi8(0x0F);
+                auto const bit_table =
+                    _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+                auto const low_nibbles = _mm_and_si128(chunk, nibble_mask);
+                auto const high_nibbles = _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble_mask);
+
+                // the highest bit of a char selects the table
+                auto const rows = _mm_blendv_epi8(
+                    _mm_shuffle_epi8(low_table, low_nibbles),
+                    _mm_shuffle_epi8(high_table, low_nibbles), chunk);
+                auto const bits = _mm_shuffle_epi8(bit_table, high_nibbles);
+
+                return static_cast<u32>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(rows, bits), bits)));
+            }
+
+            template<std::integral T>
+            CERBLIB_TARGET("sse4.2")
+            auto findClass(T const *location, size_t limit, CharClass const &char_class)
+                -> T const *
+            {
+                static_assert(sizeof(T) == sizeof(u8));
+
+                if (limit < width) {
+                    return private_::findClassScalar(location, limit, char_class);
+                }
+
+                auto const low_table = sse2::load(char_class.getLowTable().data());
+                auto const high_table = sse2::load(char_class.getHighTable().data());
+
+                for (size_t index = 0; index != limit; index += width) {
+                    index = min(index, limit - width);
+                    auto mask = classMask(sse2::load(location + index), low_table, high_table);
+
+                    if (mask != 0) {
+                        return location + index + static_cast<size_t>(std::countr_zero(mask));
+                    }
+                }
+
+                return location + limit;
+            }
+
+            template<std::integral T>
+            CERBLIB_TARGET("sse4.2")
+            auto findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if constexpr (sizeof(T) > sizeof(u16)) {
+                    return sse2::findAnyOf(location, limit, needles, needles_count);
+                } else {
+                    constexpr int mode = (sizeof(T) == sizeof(u8) ? _SIDD_UBYTE_OPS
+                                                                  : _SIDD_UWORD_OPS) |
+                                         _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+
+                    if (needles_count > step) {
+                        if constexpr (sizeof(T) == sizeof(u8)) {
+                            auto const char_class = private_::makeCharClass(needles, needles_count);
+                            return sse42::findClass(location, limit, char_class);
+                        } else {
+                            return sse2::findAnyOf(location, limit, needles, needles_count);
+                        }
+                    }
+
+                    if (limit < step) {
+                        return private_::findAnyOfScalar(location, limit, needles, needles_count);
+                    }
+
+                    std::array<T, step> needles_storage{};
+                    std::copy(needles, needles + needles_count, needles_storage.begin());
+
+                    auto const needles_vector = sse2::load(needles_storage.data());
+                    auto const needles_length = static_cast<int>(needles_count);
+
+                    for (size_t index = 0; index != limit; index += step) {
+                        index = min(index, limit - step);
+
+                        auto match_index = _mm_cmpestri(
+                            needles_vector, needles_length, sse2::load(location + index),
+                            static_cast<int>(step), mode);
+
+                        if (match_index != static_cast<int>(step)) {
+                            return location + index + static_cast<size_t>(match_index);
+                        }
+                    }
+
+                    return location + limit;
+                }
+            }
+
+            template<std::unsigned_integral T>
+            CERBLIB_TARGET("popcnt")
+            auto popCount(T const *location, size_t length) -> size_t
+            {
+                size_t result = 0;
+
+                for (size_t i = 0; i != length; ++i) {
+                    if constexpr (sizeof(T) == sizeof(u64)) {
+                        result += static_cast<size_t>(_mm_popcnt_u64(location[i]));
+                    } else {
+                        result += static_cast<size_t>(_mm_popcnt_u32(location[i]));
+                    }
+                }
+
+                return result;
+            }
+        }// namespace sse42
+
+        namespace avx2
+        {
+            constexpr size_t width = sizeof(__m256i);
+
+            CERBLIB_TARGET("avx2") inline auto load(void const *location) -> __m256i
+            {
+                return _mm256_loadu_si256(static_cast<__m256i const *>(location));
+            }
+
+            CERBLIB_TARGET("avx2") inline auto store(void *location, __m256i value) -> void
+            {
+                _mm256_storeu_si256(static_cast<__m256i *>(location), value);
+            }
+
+            CERBLIB_TARGET("avx2") inline auto stream(void *location, __m256i value) -> void
+            {
+                _mm256_stream_si256(static_cast<__m256i *>(location), value);
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx2")
+            inline auto broadcast(T value) -> __m256i
+            {
+                auto const bits = private_::asSignedIntegral(value);
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    return _mm256_set1_epi8(bits);
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    return _mm256_set1_epi16(bits);
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    return _mm256_set1_epi32(bits);
+                } else {
+                    return _mm256_set1_epi64x(bits);
+                }
+            }
+
+            // returns a byte mask, where all bytes of the matched elements are set
+            template<size_t ElementSize>
+            CERBLIB_TARGET("avx2")
+            inline auto matchMask(__m256i lhs, __m256i rhs) -> u32
+            {
+                if constexpr (ElementSize == sizeof(u8)) {
+                    return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+                } else if constexpr (ElementSize == sizeof(u16)) {
+                    return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(lhs, rhs)));
+                } else if constexpr (ElementSize == sizeof(u32)) {
+                    return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)));
+                } else {
+                    return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(lhs, rhs)));
+                }
+            }
+
+            CERBLIB_TARGET("avx2")
+            inline auto storeRepeated(u8 *dest, __m256i pattern, size_t bytes, bool non_temporal)
+                -> void
+            {
+                size_t offset = 0;
+
+                if (non_temporal) {
+                    store(dest, pattern);
+                    offset = (width - private_::misalignment(dest, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(dest + offset, pattern);
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(dest + offset, pattern);
+                }
+
+                if (offset != bytes) {
+                    store(dest + bytes - width, pattern);
+                }
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx2")
+            auto fill(T *dest, T value, size_t times) -> void
+            {
+                auto const bytes = times * sizeof(T);
+
+                if (bytes < width) {
+                    return sse2::fill(dest, value, times);
+                }
+
+                auto const non_temporal = logicalAnd(
+                    bytes >= NonTemporalThreshold, private_::misalignment(dest, sizeof(T)) == 0);
+
+                storeRepeated(static_cast<u8 *>(static_cast<void *>(dest)), broadcast(value),
+                              bytes, non_temporal);
+            }
+
+            CERBLIB_TARGET("avx2")
+            inline auto copy(void *dest, void const *src, size_t bytes) -> void
+            {
+                auto *out = static_cast<u8 *>(dest);
+                auto const *in = static_cast<u8 const *>(src);
+
+                if (bytes < width) {
+                    return sse2::copy(dest, src, bytes);
+                }
+
+                auto const tail = load(in + bytes - width);
+                size_t offset = 0;
+
+                if (bytes >= NonTemporalThreshold) {
+                    store(out, load(in));
+                    offset = (width - private_::misalignment(out, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(out + offset, load(in + offset));
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(out + offset, load(in + offset));
+                }
+
+                store(out + bytes - width, tail);
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx2")
+            auto find(T const *location, T value, size_t limit) -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if (limit < step) {
+                    return sse2::find(location, value, limit);
+                }
+
+                auto const pattern = broadcast(value);
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+                    auto mask = matchMask<sizeof(T)>(load(location + index), pattern);
+
+                    if (mask != 0) {
+                        auto match_index = static_cast<size_t>(std::countr_zero(mask)) / sizeof(T);
+                        return location + index + match_index;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            CERBLIB_TARGET("avx2")
+            inline auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+            {
+                constexpr u32 all_bytes_match = 0xFFFF'FFFFU;
+
+                auto const *first = static_cast<u8 const *>(lhs);
+                auto const *second = static_cast<u8 const *>(rhs);
+
+                if (bytes < width) {
+                    return sse2::mismatch(lhs, rhs, bytes);
+                }
+
+                for (size_t offset = 0; offset != bytes; offset += width) {
+                    offset = min(offset, bytes - width);
+
+                    auto mask = matchMask<1>(load(first + offset), load(second + offset));
+
+                    if (mask != all_bytes_match) {
+                        return offset + static_cast<size_t>(std::countr_one(mask));
+                    }
+                }
+
+                return bytes;
+            }
+
+            CERBLIB_TARGET("avx2")
+            inline auto classMask(__m256i chunk, __m256i low_table, __m256i high_table) -> u32
+            {
+                auto const nibble_mask = _mm256_set1_epi8(0x0F);
+                auto const bit_table = _mm256_setr_epi8(
+                    1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                    64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+                auto const low_nibbles = _mm256_and_si256(chunk, nibble_mask);
+                auto const high_nibbles =
+                    _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble_mask);
+
+                // the highest bit of a char selects the table
+                auto const rows = _mm256_blendv_epi8(
+                    _mm256_shuffle_epi8(low_table, low_nibbles),
+                    _mm256_shuffle_epi8(high_table, low_nibbles), chunk);
+                auto const bits = _mm256_shuffle_epi8(bit_table, high_nibbles);
+
+                return static_cast<u32>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(rows, bits), bits)));
+            }
+
+            template<std::integral T>
+            CERBLIB_TARGET("avx2")
+            auto findClass(T const *location, size_t limit, CharClass const &char_class)
+                -> T const *
+            {
+                static_assert(sizeof(T) == sizeof(u8));
+
+                if (limit < width) {
+                    return sse42::findClass(location, limit, char_class);
+                }
+
+                auto const low_table =
+                    _mm256_broadcastsi128_si256(sse2::load(char_class.getLowTable().data()));
+                auto const high_table =
+                    _mm256_broadcastsi128_si256(sse2::load(char_class.getHighTable().data()));
+
+                for (size_t index = 0; index != limit; index += width) {
+                    index = min(index, limit - width);
+                    auto mask = classMask(load(location + index), low_table, high_table);
+
+                    if (mask != 0) {
+                        return location + index + static_cast<size_t>(std::countr_zero(mask));
+                    }
+                }
+
+                return location + limit;
+            }
+
+            template<std::integral T>
+            CERBLIB_TARGET("avx2")
+            auto findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    if (needles_count > MaxBroadcastNeedles) {
+                        auto const char_class = private_::makeCharClass(needles, needles_count);
+                        return avx2::findClass(location, limit, char_class);
+                    }
+                }
+
+                if (logicalOr(limit < step, needles_count > MaxBroadcastNeedles)) {
+                    return sse42::findAnyOf(location, limit, needles, needles_count);
+                }
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+
+                    auto const chunk = load(location + index);
+                    u32 mask = 0;
+
+                    for (size_t i = 0; i != needles_count; ++i) {
+                        mask |= matchMask<sizeof(T)>(chunk, broadcast(needles[i]));
+                    }
+
+                    if (mask != 0) {
+                        auto match_index = static_cast<size_t>(std::countr_zero(mask)) / sizeof(T);
+                        return location + index + match_index;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // marks elements, which are equal to the head and are followed by the tail
+            // at tail_offset bytes
+            template<size_t ElementSize>
+            CERBLIB_TARGET("avx2")
+            inline auto candidateMask(
+                void const *location, size_t tail_offset, __m256i head, __m256i tail) -> u32
+            {
+                auto const *bytes = static_cast<u8 const *>(location);
+
+                return matchMask<ElementSize>(load(bytes), head) &
+                       matchMask<ElementSize>(load(bytes + tail_offset), tail) &
+                       private_::element_start_bits<ElementSize>;
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            CERBLIB_TARGET("avx2")
+            auto search(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return sse2::search(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t index = 0; index != candidates; index += step) {
+                    index = min(index, candidates - step);
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    for (; mask != 0; mask &= mask - 1) {
+                        auto const match_index = static_cast<size_t>(std::countr_zero(mask));
+                        auto const *candidate = location + index + match_index / sizeof(T);
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            CERBLIB_TARGET("avx2")
+            auto rsearch(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return sse2::rsearch(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t processed = 0; processed != candidates; processed += step) {
+                    processed = min(processed, candidates - step);
+                    auto const index = candidates - step - processed;
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    while (mask != 0) {
+                        auto const bit = private_::highestBit(mask);
+                        auto const *candidate = location + index + bit / sizeof(T);
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+
+                        mask ^= static_cast<u32>(1) << bit;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            template<BitwiseOperation Operation>
+            CERBLIB_TARGET("avx2")
+            inline auto applyBitwise(__m256i dest, __m256i src) -> __m256i
+            {
+                if constexpr (Operation == BitwiseOperation::AND) {
+                    return _mm256_and_si256(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::OR) {
+                    return _mm256_or_si256(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::XOR) {
+                    return _mm256_xor_si256(dest, src);
+                } else {
+                    return _mm256_andnot_si256(src, dest);
+                }
+            }
+
+            template<BitwiseOperation Operation, std::unsigned_integral T>
+            CERBLIB_TARGET("avx2")
+            auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+            {
+                constexpr size_t step = width / sizeof(T);
+                size_t index = 0;
+
+                for (; index + step <= length; index += step) {
+                    auto const lhs = load(dest + index);
+                    store(dest + index, applyBitwise<Operation>(lhs, load(src + index)));
+                }
+
+                sse2::bitwiseApply<Operation>(dest + index, src + index, length - index);
+            }
+
+            template<bit::ValueOfBit BitValue>
+            CERBLIB_TARGET("avx2")
+            inline auto applyAxisMask(__m256i mask, __m256i axis) -> __m256i
+            {
+                if constexpr (BitValue == bit::ValueOfBit::ONE) {
+                    return _mm256_and_si256(mask, axis);
+                } else if constexpr (BitValue == bit::ValueOfBit::ZERO) {
+                    return _mm256_andnot_si256(axis, mask);
+                } else {
+                    return mask;
+                }
+            }
+
+            template<bit::ValueOfBit... BitValues, size_t Length>
+            CERBLIB_TARGET("avx2")
+            auto findMaskedWord(std::array<size_t, Length> const *axes, size_t from) -> size_t
+            {
+                constexpr size_t step = width / sizeof(size_t);
+                auto const zero = _mm256_setzero_si256();
+
+                for (; from + step <= Length; from += step) {
+                    auto mask = _mm256_set1_epi64x(-1);
+                    size_t axis = 0;
+
+                    ((mask = applyAxisMask<BitValues>(mask, load(&axes[axis++][from]))), ...);
+
+                    if (_mm256_testz_si256(mask, mask) == 0) {
+                        auto const zero_words = _mm256_movemask_pd(
+                            _mm256_castsi256_pd(_mm256_cmpeq_epi64(mask, zero)));
+                        auto const non_zero_words = static_cast<u32>(~zero_words) & 0xFU;
+                        return from + static_cast<size_t>(std::countr_zero(non_zero_words));
+                    }
+                }
+
+                return cerb::private_::findMaskedWordScalar<BitValues...>(axes, from);
+            }
+        }// namespace avx2
+
+        namespace avx512
+        {
+            constexpr size_t width = sizeof(__m512i);
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto load(void const *location) -> __m512i
+            {
+                return _mm512_loadu_si512(location);
+            }
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto store(void *location, __m512i value) -> void
+            {
+                _mm512_storeu_si512(location, value);
+            }
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto stream(void *location, __m512i value) -> void
+            {
+                _mm512_stream_si512(static_cast<__m512i *>(location), value);
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto broadcast(T value) -> __m512i
+            {
+                auto const bits = private_::asSignedIntegral(value);
+
+                if constexpr (sizeof(T) == sizeof(u8)) {
+                    return _mm512_set1_epi8(bits);
+                } else if constexpr (sizeof(T) == sizeof(u16)) {
+                    return _mm512_set1_epi16(bits);
+                } else if constexpr (sizeof(T) == sizeof(u32)) {
+                    return _mm512_set1_epi32(bits);
+                } else {
+                    return _mm512_set1_epi64(bits);
+                }
+            }
+
+            // unlike sse2 and avx2 versions, returns one bit per element
+            template<size_t ElementSize>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto matchMask(__m512i lhs, __m512i rhs) -> u64
+            {
+                if constexpr (ElementSize == sizeof(u8)) {
+                    return _mm512_cmpeq_epi8_mask(lhs, rhs);
+                } else if constexpr (ElementSize == sizeof(u16)) {
+                    return _mm512_cmpeq_epi16_mask(lhs, rhs);
+                } else if constexpr (ElementSize == sizeof(u32)) {
+                    return _mm512_cmpeq_epi32_mask(lhs, rhs);
+                } else {
+                    return _mm512_cmpeq_epi64_mask(lhs, rhs);
+                }
+            }
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto storeRepeated(u8 *dest, __m512i pattern, size_t bytes, bool non_temporal)
+                -> void
+            {
+                size_t offset = 0;
+
+                if (non_temporal) {
+                    store(dest, pattern);
+                    offset = (width - private_::misalignment(dest, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(dest + offset, pattern);
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(dest + offset, pattern);
+                }
+
+                if (offset != bytes) {
+                    store(dest + bytes - width, pattern);
+                }
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto fill(T *dest, T value, size_t times) -> void
+            {
+                auto const bytes = times * sizeof(T);
+
+                if (bytes < width) {
+                    return avx2::fill(dest, value, times);
+                }
+
+                auto const non_temporal = logicalAnd(
+                    bytes >= NonTemporalThreshold, private_::misalignment(dest, sizeof(T)) == 0);
+
+                storeRepeated(static_cast<u8 *>(static_cast<void *>(dest)), broadcast(value),
+                              bytes, non_temporal);
+            }
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto copy(void *dest, void const *src, size_t bytes) -> void
+            {
+                auto *out = static_cast<u8 *>(dest);
+                auto const *in = static_cast<u8 const *>(src);
+
+                if (bytes < width) {
+                    return avx2::copy(dest, src, bytes);
+                }
+
+                auto const tail = load(in + bytes - width);
+                size_t offset = 0;
+
+                if (bytes >= NonTemporalThreshold) {
+                    store(out, load(in));
+                    offset = (width - private_::misalignment(out, width)) % width;
+
+                    for (; offset + width <= bytes; offset += width) {
+                        stream(out + offset, load(in + offset));
+                    }
+
+                    _mm_sfence();
+                }
+
+                for (; offset + width <= bytes; offset += width) {
+                    store(out + offset, load(in + offset));
+                }
+
+                store(out + bytes - width, tail);
+            }
+
+            template<typename T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto find(T const *location, T value, size_t limit) -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if (limit < step) {
+                    return avx2::find(location, value, limit);
+                }
+
+                auto const pattern = broadcast(value);
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+                    auto mask = matchMask<sizeof(T)>(load(location + index), pattern);
+
+                    if (mask != 0) {
+                        auto match_index = static_cast<size_t>(std::countr_zero(mask));
+                        return location + index + match_index;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto mismatch(void const *lhs, void const *rhs, size_t bytes) -> size_t
+            {
+                auto const *first = static_cast<u8 const *>(lhs);
+                auto const *second = static_cast<u8 const *>(rhs);
+
+                if (bytes < width) {
+                    return avx2::mismatch(lhs, rhs, bytes);
+                }
+
+                for (size_t offset = 0; offset != bytes; offset += width) {
+                    offset = min(offset, bytes - width);
+
+                    u64 mask = _mm512_cmpneq_epi8_mask(load(first + offset), load(second + offset));
+
+                    if (mask != 0) {
+                        return offset + static_cast<size_t>(std::countr_zero(mask));
+                    }
+                }
+
+                return bytes;
+            }
+
+            template<std::integral T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto findAnyOf(T const *location, size_t limit, T const *needles, size_t needles_count)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+
+                if (logicalOr(limit < step, needles_count > MaxBroadcastNeedles)) {
+                    return avx2::findAnyOf(location, limit, needles, needles_count);
+                }
+
+                for (size_t index = 0; index != limit; index += step) {
+                    index = min(index, limit - step);
+
+                    auto const chunk = load(location + index);
+                    u64 mask = 0;
+
+                    for (size_t i = 0; i != needles_count; ++i) {
+                        mask |= matchMask<sizeof(T)>(chunk, broadcast(needles[i]));
+                    }
+
+                    if (mask != 0) {
+                        return location + index + static_cast<size_t>(std::countr_zero(mask));
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // marks elements, which are equal to the head and are followed by the tail
+            // at tail_offset bytes
+            template<size_t ElementSize>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto candidateMask(
+                void const *location, size_t tail_offset, __m512i head, __m512i tail) -> u64
+            {
+                auto const *bytes = static_cast<u8 const *>(location);
+
+                return matchMask<ElementSize>(load(bytes), head) &
+                       matchMask<ElementSize>(load(bytes + tail_offset), tail);
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto search(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return avx2::search(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t index = 0; index != candidates; index += step) {
+                    index = min(index, candidates - step);
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    for (; mask != 0; mask &= mask - 1) {
+                        auto const match_index = static_cast<size_t>(std::countr_zero(mask));
+                        auto const *candidate = location + index + match_index;
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+                    }
+                }
+
+                return location + limit;
+            }
+
+            // needle_length must be in range [1, limit]
+            template<typename T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto rsearch(T const *location, size_t limit, T const *needle, size_t needle_length)
+                -> T const *
+            {
+                constexpr size_t step = width / sizeof(T);
+                auto const candidates = limit - needle_length + 1;
+
+                if (candidates < step) {
+                    return avx2::rsearch(location, limit, needle, needle_length);
+                }
+
+                auto const head = broadcast(needle[0]);
+                auto const tail = broadcast(needle[needle_length - 1]);
+                auto const tail_offset = (needle_length - 1) * sizeof(T);
+
+                for (size_t processed = 0; processed != candidates; processed += step) {
+                    processed = min(processed, candidates - step);
+                    auto const index = candidates - step - processed;
+
+                    auto mask = candidateMask<sizeof(T)>(location + index, tail_offset, head, tail);
+
+                    while (mask != 0) {
+                        auto const bit = private_::highestBit(mask);
+                        auto const *candidate = location + index + bit;
+
+                        if (cerb::private_::isNeedleAt(candidate, needle, needle_length)) {
+                            return candidate;
+                        }
+
+                        mask ^= static_cast<u64>(1) << bit;
+                    }
+                }
+
+                return location + limit;
+            }
+
+            template<BitwiseOperation Operation>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            inline auto applyBitwise(__m512i dest, __m512i src) -> __m512i
+            {
+                if constexpr (Operation == BitwiseOperation::AND) {
+                    return _mm512_and_si512(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::OR) {
+                    return _mm512_or_si512(dest, src);
+                } else if constexpr (Operation == BitwiseOperation::XOR) {
+                    return _mm512_xor_si512(dest, src);
+                } else {
+                    // truth table of dest & ~src, _mm512_andnot_si512 triggers maybe-uninitialized
+                    // warnings in GCC 12
+                    constexpr int dest_and_not_src = 0x30;
+                    return _mm512_ternarylogic_epi64(dest, src, src, dest_and_not_src);
+                }
+            }
+
+            template<BitwiseOperation Operation, std::unsigned_integral T>
+            CERBLIB_TARGET("avx512f,avx512bw")
+            auto bitwiseApply(T *dest, T const *src, size_t length) -> void
+            {
+                constexpr size_t step = width / sizeof(T);
+                size_t index = 0;
+
+                for (; index + step <= length; index += step) {
+                    auto const lhs = load(dest + index);
+                    store(dest + index, applyBitwise<Operation>(lhs, load(src + index)));
+                }
+
+                avx2::bitwiseApply<Operation>(dest + index, src + index, length - index);
+            }
+        }// namespace avx512
+    }    // namespace amd64
+#endif   /* CERBLIB_SIMD */
+}// namespace cerb
+
+#endif /* CERBERUS_SIMD_HPP */
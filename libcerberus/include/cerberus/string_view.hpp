@@ -115,11 +115,36 @@ namespace cerb
             return ptrdiff(begin(), cerb::find(string + position, chr, length - position));
         }
 
+        CERBLIB_DECL auto find(BasicStringView const &str, size_t position = 0) const -> size_t
+        {
+            if (position + str.size() > length) {
+                return npos;
+            }
+
+            auto const *rest = string + position;
+            auto const *found = cerb::search(rest, length - position, str.data(), str.size());
+            return logicalAnd(found == end(), not str.empty()) ? npos : ptrdiff(begin(), found);
+        }
+
         CERBLIB_DECL auto rfind(CharT chr) const -> size_t
         {
             return ptrdiff(cerb::rfind(*this, chr), rend()) - 1;
         }
 
+        CERBLIB_DECL auto rfind(BasicStringView const &str) const -> size_t
+        {
+            if (str.size() > length) {
+                return npos;
+            }
+
+            if (str.empty()) {
+                return length;
+            }
+
+            auto const *found = cerb::rsearch(string, length, str.data(), str.size());
+            return found == end() ? npos : ptrdiff(begin(), found);
+        }
+
         CERBLIB_DECL auto rfind2(CharT chr) const
         {
             return cerb::rfind(*this, chr);
@@ -160,8 +185,11 @@ namespace cerb
         template<StringType<CharT> T>
         CERBLIB_DECL auto operator==(T const &other) const -> bool
         {
-            auto other_str = BasicStringView<CharT>(std::data(other), std::size(other));
-            return std::ranges::equal(*this, other_str);
+            if (length != std::size(other)) {
+                return false;
+            }
+
+            return equal(string, std::data(other), length);
         }
 
         CERBLIB_DECL auto operator<=>(CharT const *other) const -> decltype(auto)
@@ -172,16 +200,7 @@ namespace cerb
         template<StringType<CharT> T>
         CERBLIB_DECL auto operator<=>(T const &other) const
         {
-            size_t maximum_checking_length = min<size_type>(length, std::size(other));
-
-            CERBLIB_UNROLL_N(4)
-            for (size_t i = 0; i != maximum_checking_length; ++i) {
-                if (at(i) != other.at(i)) {
-                    return at(i) <=> other.at(i);
-                }
-            }
-
-            return length <=> std::size(other);
+            return compare(string, length, std::data(other), std::size(other));
         }
 
         BasicStringView() = default;